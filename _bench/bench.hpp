@@ -0,0 +1,250 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include "perf_counters.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Bench
+{
+    // prevents the optimizer from discarding a computed value
+    template <typename T>
+    inline void do_not_optimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    struct Options
+    {
+        std::vector<std::size_t> sizes;      // empty - every suite uses its own defaults
+        std::vector<unsigned> thread_counts; // empty - 1, 2, 4, ... up to all cores
+        std::size_t min_repetitions = 3;
+        std::size_t max_repetitions = 1000;
+        std::chrono::duration<double> min_time{0.2};
+        std::string filter;
+        std::string json_path;
+        std::string csv_path;
+        bool perf = false; // hardware counters (cycles, instructions, misses) averaged per repetition
+    };
+
+    struct Result
+    {
+        std::string suite;
+        std::string name;
+        std::size_t size{};
+        unsigned threads{};
+        std::size_t repetitions{};
+        double min_ns{};
+        double median_ns{};
+        double mean_ns{};
+        std::vector<std::pair<std::string, double>> counters;
+
+        double items_per_second() const
+        {
+            return median_ns > 0.0 ? static_cast<double>(size) * 1e9 / median_ns : 0.0;
+        }
+
+        Result& counter(std::string name, double value)
+        {
+            counters.emplace_back(std::move(name), value);
+            return *this;
+        }
+    };
+
+    class Runner
+    {
+        Options options_;
+        std::string suite_;
+        std::deque<Result> results_; // deque - references returned by run() stay valid
+        std::unique_ptr<PerfCounters> perf_;
+
+    public:
+        explicit Runner(Options options)
+            : options_{std::move(options)}
+        {
+            if (options_.perf) // opened before suites start worker threads - inherited by them
+                perf_ = std::make_unique<PerfCounters>();
+        }
+
+        const Options& options() const
+        {
+            return options_;
+        }
+
+        void start_suite(std::string name)
+        {
+            suite_ = std::move(name);
+        }
+
+        const std::deque<Result>& results() const
+        {
+            return results_;
+        }
+
+        // nullptr if --perf was not requested
+        const PerfCounters* perf_counters() const
+        {
+            return perf_.get();
+        }
+
+        std::vector<std::size_t> sizes(std::vector<std::size_t> defaults) const
+        {
+            return options_.sizes.empty() ? defaults : options_.sizes;
+        }
+
+        std::vector<unsigned> thread_counts() const;
+
+        // setup() runs before every repetition and is not timed
+        template <typename Setup, typename Body>
+        Result& run(std::string name, std::size_t size, unsigned threads, Setup&& setup, Body&& body)
+        {
+            using Clock = std::chrono::steady_clock;
+
+            std::vector<double> samples;
+            std::chrono::duration<double> total{};
+
+            if (perf_)
+                perf_->reset();
+
+            while (samples.size() < options_.min_repetitions
+                || (total < options_.min_time && samples.size() < options_.max_repetitions))
+            {
+                setup();
+
+                if (perf_)
+                    perf_->enable();
+
+                const auto start = Clock::now();
+                body();
+                const auto elapsed = Clock::now() - start;
+
+                if (perf_)
+                    perf_->disable();
+
+                total += elapsed;
+                samples.push_back(std::chrono::duration<double, std::nano>(elapsed).count());
+            }
+
+            return record(std::move(name), size, threads, std::move(samples));
+        }
+
+        template <typename Body>
+        Result& run(std::string name, std::size_t size, unsigned threads, Body&& body)
+        {
+            return run(std::move(name), size, threads, [] {}, std::forward<Body>(body));
+        }
+
+    private:
+        Result& record(std::string name, std::size_t size, unsigned threads, std::vector<double> samples)
+        {
+            std::sort(samples.begin(), samples.end());
+
+            Result& result = results_.emplace_back();
+            result.suite = suite_;
+            result.name = std::move(name);
+            result.size = size;
+            result.threads = threads;
+            result.repetitions = samples.size();
+            result.min_ns = samples.front();
+            result.median_ns = samples[samples.size() / 2];
+            result.mean_ns = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+
+            if (perf_)
+                record_perf_counters(result);
+
+            std::cout << std::left << std::setw(40) << result.name << std::right
+                      << std::setw(12) << result.size
+                      << std::setw(5) << result.threads
+                      << std::setw(16) << std::fixed << std::setprecision(3) << result.median_ns / 1e6 << " ms"
+                      << std::setw(16) << std::setprecision(1) << result.items_per_second() / 1e6 << " M/s\n";
+
+            if (!result.counters.empty())
+                print_counters(result);
+
+            return result;
+        }
+
+        void record_perf_counters(Result& result) const
+        {
+            double cycles = 0.0, instructions = 0.0;
+
+            for (const auto& [name, total] : perf_->read())
+            {
+                const double value = total / result.repetitions;
+                result.counter(name, value);
+
+                if (name == "cycles")
+                    cycles = value;
+                else if (name == "instructions")
+                    instructions = value;
+            }
+
+            if (cycles > 0.0 && instructions > 0.0)
+                result.counter("ipc", instructions / cycles);
+        }
+
+        // counters per item (per repetition if size == 0), ipc as is
+        static void print_counters(const Result& result)
+        {
+            const double items = result.size > 0 ? static_cast<double>(result.size) : 1.0;
+
+            std::cout << "    ";
+            for (const auto& [name, value] : result.counters)
+            {
+                if (name == "ipc")
+                    std::cout << name << " " << std::setprecision(2) << value << "  ";
+                else
+                    std::cout << name << (result.size > 0 ? "/item " : " ") << std::setprecision(3) << value / items << "  ";
+            }
+            std::cout << "\n";
+        }
+    };
+
+    using SuiteFunction = void (*)(Runner&);
+
+    struct Suite
+    {
+        const char* name;
+        SuiteFunction function;
+    };
+
+    inline std::vector<Suite>& registry()
+    {
+        static std::vector<Suite> suites;
+        return suites;
+    }
+
+    struct SuiteRegistrar
+    {
+        SuiteRegistrar(const char* name, SuiteFunction function)
+        {
+            registry().push_back(Suite{name, function});
+        }
+    };
+}
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+
+// defines a benchmark suite - the body has access to Bench::Runner& runner
+#define BENCHMARK_SUITE(name)                                                                                     \
+    static void BENCH_CONCAT(bench_suite_, __LINE__)(Bench::Runner&);                                             \
+    static const Bench::SuiteRegistrar BENCH_CONCAT(bench_registrar_, __LINE__){name, &BENCH_CONCAT(bench_suite_, __LINE__)}; \
+    static void BENCH_CONCAT(bench_suite_, __LINE__)([[maybe_unused]] Bench::Runner & runner)
+
+#endif
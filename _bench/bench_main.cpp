@@ -0,0 +1,257 @@
+#include "bench.hpp"
+
+#include <charconv>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+
+using namespace std::literals;
+
+std::vector<unsigned> Bench::Runner::thread_counts() const
+{
+    if (!options_.thread_counts.empty())
+        return options_.thread_counts;
+
+    const unsigned all_cores = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<unsigned> counts;
+    for (unsigned threads = 1; threads < all_cores; threads *= 2)
+        counts.push_back(threads);
+    counts.push_back(all_cores);
+
+    return counts;
+}
+
+namespace
+{
+    // accepts plain numbers and K/M/G suffixes - "1K", "10M", "100M"
+    std::size_t parse_size(std::string_view text)
+    {
+        std::size_t value{};
+        const auto [end, error_code] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+        if (error_code != std::errc{})
+            throw std::invalid_argument("invalid size: "s + std::string(text));
+
+        std::string_view suffix(end, text.data() + text.size() - end);
+
+        if (suffix == "K"sv || suffix == "k"sv)
+            return value * 1'000;
+        if (suffix == "M"sv)
+            return value * 1'000'000;
+        if (suffix == "G"sv)
+            return value * 1'000'000'000;
+        if (!suffix.empty())
+            throw std::invalid_argument("invalid size suffix: "s + std::string(text));
+
+        return value;
+    }
+
+    template <typename T>
+    std::vector<T> parse_list(std::string_view text)
+    {
+        std::vector<T> values;
+
+        while (!text.empty())
+        {
+            const auto comma = text.find(',');
+            values.push_back(static_cast<T>(parse_size(text.substr(0, comma))));
+            text = (comma == std::string_view::npos) ? std::string_view{} : text.substr(comma + 1);
+        }
+
+        return values;
+    }
+
+    void print_usage(const char* program)
+    {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --sizes 1K,1M,100M   input sizes (default: per suite)\n"
+                  << "  --threads 1,2,4      thread counts (default: powers of two up to all cores)\n"
+                  << "  --min-reps N         minimal number of repetitions (default: 3)\n"
+                  << "  --max-reps N         maximal number of repetitions (default: 1000)\n"
+                  << "  --min-time SECONDS   minimal measured time per benchmark (default: 0.2)\n"
+                  << "  --filter TEXT        runs only suites containing TEXT\n"
+                  << "  --json PATH          writes results as JSON\n"
+                  << "  --csv PATH           writes results as CSV\n"
+                  << "  --perf               adds hardware counters (Linux perf_event_open) to the results\n"
+                  << "  --list               lists registered suites\n";
+    }
+
+    std::string json_escape(std::string_view text)
+    {
+        std::string escaped;
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+                escaped += '\\';
+            escaped += c;
+        }
+        return escaped;
+    }
+
+    std::string csv_quote(std::string_view text)
+    {
+        if (text.find_first_of(",\"\n") == std::string_view::npos)
+            return std::string(text);
+
+        std::string quoted = "\"";
+        for (char c : text)
+        {
+            if (c == '"')
+                quoted += '"';
+            quoted += c;
+        }
+        return quoted + '"';
+    }
+
+    std::vector<std::string> counter_names(const std::deque<Bench::Result>& results)
+    {
+        std::vector<std::string> names;
+        std::set<std::string> seen;
+
+        for (const auto& result : results)
+            for (const auto& [name, value] : result.counters)
+                if (seen.insert(name).second)
+                    names.push_back(name);
+
+        return names;
+    }
+
+    void write_json(const std::string& path, const std::deque<Bench::Result>& results)
+    {
+        std::ofstream out(path);
+        out << std::setprecision(17) << "[\n";
+
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const auto& r = results[i];
+
+            out << "  {\"suite\": \"" << json_escape(r.suite) << "\", \"name\": \"" << json_escape(r.name) << "\""
+                << ", \"size\": " << r.size << ", \"threads\": " << r.threads
+                << ", \"repetitions\": " << r.repetitions
+                << ", \"min_ns\": " << r.min_ns << ", \"median_ns\": " << r.median_ns << ", \"mean_ns\": " << r.mean_ns
+                << ", \"items_per_second\": " << r.items_per_second();
+
+            for (const auto& [name, value] : r.counters)
+                out << ", \"" << json_escape(name) << "\": " << value;
+
+            out << (i + 1 < results.size() ? "},\n" : "}\n");
+        }
+
+        out << "]\n";
+    }
+
+    void write_csv(const std::string& path, const std::deque<Bench::Result>& results)
+    {
+        const auto counters = counter_names(results);
+
+        std::ofstream out(path);
+        out << std::setprecision(17) << "suite,name,size,threads,repetitions,min_ns,median_ns,mean_ns,items_per_second";
+        for (const auto& name : counters)
+            out << ',' << csv_quote(name);
+        out << '\n';
+
+        for (const auto& r : results)
+        {
+            out << csv_quote(r.suite) << ',' << csv_quote(r.name) << ',' << r.size << ',' << r.threads << ',' << r.repetitions << ','
+                << r.min_ns << ',' << r.median_ns << ',' << r.mean_ns << ',' << r.items_per_second();
+
+            for (const auto& name : counters)
+            {
+                out << ',';
+                auto pos = std::find_if(r.counters.begin(), r.counters.end(), [&](const auto& c) { return c.first == name; });
+                if (pos != r.counters.end())
+                    out << pos->second;
+            }
+
+            out << '\n';
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Bench::Options options;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+
+            auto next_value = [&]() -> std::string_view {
+                if (i + 1 >= argc)
+                    throw std::invalid_argument("missing value for "s + std::string(arg));
+                return argv[++i];
+            };
+
+            if (arg == "--sizes")
+                options.sizes = parse_list<std::size_t>(next_value());
+            else if (arg == "--threads")
+                options.thread_counts = parse_list<unsigned>(next_value());
+            else if (arg == "--min-reps")
+                options.min_repetitions = std::max<std::size_t>(1, parse_size(next_value()));
+            else if (arg == "--max-reps")
+                options.max_repetitions = std::max<std::size_t>(1, parse_size(next_value()));
+            else if (arg == "--min-time")
+                options.min_time = std::chrono::duration<double>(std::stod(std::string(next_value())));
+            else if (arg == "--filter")
+                options.filter = next_value();
+            else if (arg == "--json")
+                options.json_path = next_value();
+            else if (arg == "--csv")
+                options.csv_path = next_value();
+            else if (arg == "--perf")
+                options.perf = true;
+            else if (arg == "--list")
+            {
+                for (const auto& suite : Bench::registry())
+                    std::cout << suite.name << "\n";
+                return EXIT_SUCCESS;
+            }
+            else
+            {
+                print_usage(argv[0]);
+                return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << "\n";
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+#ifndef NDEBUG
+    std::cout << "WARNING: benchmarks built without optimizations (NDEBUG not defined)\n";
+#endif
+
+    Bench::Runner runner{options};
+
+    if (const auto* perf = runner.perf_counters(); perf && !perf->available())
+        std::cout << "WARNING: hardware counters not available (" << perf->error() << ") - reporting wall-clock times only\n";
+
+    for (const auto& suite : Bench::registry())
+    {
+        if (std::string_view(suite.name).find(options.filter) == std::string_view::npos)
+            continue;
+
+        std::cout << "\n### " << suite.name << "\n"
+                  << std::left << std::setw(40) << "name" << std::right << std::setw(12) << "size" << std::setw(5) << "thr"
+                  << std::setw(19) << "median" << std::setw(20) << "throughput" << "\n";
+        runner.start_suite(suite.name);
+        suite.function(runner);
+    }
+
+    if (!options.json_path.empty())
+        write_json(options.json_path, runner.results());
+
+    if (!options.csv_path.empty())
+        write_csv(options.csv_path, runner.results());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,202 @@
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Hardware performance counters (Linux perf_event_open) for benchmarked regions:
+// cycles, instructions, L1D & LLC read misses, branch misses.
+//   - counts the calling thread and threads it creates later (e.g. TBB workers started after the counters are opened)
+//   - every event is opened separately and scaled by time_enabled / time_running when the PMU multiplexes them
+//   - events the kernel refuses (perf_event_paranoid, containers, VMs without a virtual PMU) are skipped;
+//     available() == false means none could be opened and read() returns nothing
+//
+//   PerfCounters counters;
+//   {
+//       PerfScope scope{counters};
+//       work();
+//   }
+//   for (const auto& [name, value] : counters.read()) ...
+
+namespace Bench
+{
+#ifdef __linux__
+    namespace PerfDetails
+    {
+        constexpr std::uint64_t cache_read_miss(std::uint64_t cache)
+        {
+            return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        }
+    }
+#endif
+
+    class PerfCounters
+    {
+    public:
+        struct Event
+        {
+            const char* name;
+            std::uint32_t type;
+            std::uint64_t config;
+        };
+
+#ifdef __linux__
+        static constexpr std::array<Event, 5> events = {{
+            {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {"l1d_misses", PERF_TYPE_HW_CACHE, PerfDetails::cache_read_miss(PERF_COUNT_HW_CACHE_L1D)},
+            {"llc_misses", PERF_TYPE_HW_CACHE, PerfDetails::cache_read_miss(PERF_COUNT_HW_CACHE_LL)},
+            {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        }};
+#else
+        static constexpr std::array<Event, 0> events = {};
+#endif
+
+        PerfCounters()
+        {
+            fds_.fill(-1);
+
+#ifdef __linux__
+            for (std::size_t i = 0; i < events.size(); ++i)
+            {
+                perf_event_attr attr{};
+                attr.size = sizeof(attr);
+                attr.type = events[i].type;
+                attr.config = events[i].config;
+                attr.disabled = 1;
+                attr.inherit = 1;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+                fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+
+                if (fds_[i] < 0 && error_.empty())
+                    error_ = std::string(events[i].name) + ": " + std::strerror(errno);
+            }
+#else
+            error_ = "perf_event_open is not supported on this platform";
+#endif
+        }
+
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        ~PerfCounters()
+        {
+#ifdef __linux__
+            for (int fd : fds_)
+                if (fd >= 0)
+                    close(fd);
+#endif
+        }
+
+        bool available() const
+        {
+            for (int fd : fds_)
+                if (fd >= 0)
+                    return true;
+            return false;
+        }
+
+        // the first reason an event could not be opened - empty if all of them are counting
+        const std::string& error() const
+        {
+            return error_;
+        }
+
+        void reset()
+        {
+            control(Request::reset);
+        }
+
+        void enable()
+        {
+            control(Request::enable);
+        }
+
+        void disable()
+        {
+            control(Request::disable);
+        }
+
+        // totals since the last reset() - only events that could be opened
+        std::vector<std::pair<std::string, double>> read() const
+        {
+            std::vector<std::pair<std::string, double>> values;
+
+#ifdef __linux__
+            for (std::size_t i = 0; i < events.size(); ++i)
+            {
+                std::uint64_t data[3]{}; // value, time_enabled, time_running
+
+                if (fds_[i] < 0 || ::read(fds_[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)))
+                    continue;
+
+                const double scale = data[2] > 0 ? static_cast<double>(data[1]) / data[2] : 0.0;
+                values.emplace_back(events[i].name, data[0] * scale);
+            }
+#endif
+
+            return values;
+        }
+
+    private:
+        enum class Request
+        {
+            reset,
+            enable,
+            disable
+        };
+
+        void control([[maybe_unused]] Request request)
+        {
+#ifdef __linux__
+            const unsigned long code = request == Request::reset    ? PERF_EVENT_IOC_RESET
+                                     : request == Request::enable ? PERF_EVENT_IOC_ENABLE
+                                                                  : PERF_EVENT_IOC_DISABLE;
+            for (int fd : fds_)
+                if (fd >= 0)
+                    ioctl(fd, code, 0);
+#endif
+        }
+
+        std::array<int, events.size()> fds_;
+        std::string error_;
+    };
+
+    // counts the enclosing scope
+    class PerfScope
+    {
+        PerfCounters& counters_;
+
+    public:
+        explicit PerfScope(PerfCounters& counters)
+            : counters_{counters}
+        {
+            counters_.enable();
+        }
+
+        PerfScope(const PerfScope&) = delete;
+        PerfScope& operator=(const PerfScope&) = delete;
+
+        ~PerfScope()
+        {
+            counters_.disable();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,74 @@
+#include <bench.hpp>
+#include <to_int_batch.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // comma separated integers of 1-10 digits (every 8th negative), every 50th field invalid
+    std::string make_buffer(size_t count)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<int> digit_count_distribution(1, 9);
+        std::uniform_int_distribution<int> digit_distribution('0', '9');
+        std::uniform_int_distribution<int> kind_distribution(0, 399);
+
+        std::string buffer;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const int kind = kind_distribution(rnd_gen);
+            if (i > 0)
+                buffer += ',';
+            if (kind % 8 == 0)
+                buffer += '-';
+            for (int digits = digit_count_distribution(rnd_gen); digits > 0; --digits)
+                buffer += static_cast<char>(digit_distribution(rnd_gen));
+            if (kind % 50 == 1)
+                buffer += 'x';
+        }
+        return buffer;
+    }
+
+    std::vector<std::string_view> split_fields(std::string_view buffer)
+    {
+        std::vector<std::string_view> fields;
+        for (size_t start = 0;;)
+        {
+            const size_t end = std::min(buffer.find(',', start), buffer.size());
+            fields.push_back(buffer.substr(start, end - start));
+            if (end == buffer.size())
+                return fields;
+            start = end + 1;
+        }
+    }
+}
+
+BENCHMARK_SUITE("to_int - one field per call vs. batch")
+{
+    for (auto size : runner.sizes({1'000, 1'000'000, 10'000'000}))
+    {
+        const auto buffer = make_buffer(size);
+        const auto fields = split_fields(buffer);
+
+        std::vector<int> values(fields.size());
+        std::vector<uint64_t> validity((fields.size() + 63) / 64);
+
+        runner.run("to_int per field", size, 1, [&] {
+            for (size_t i = 0; i < fields.size(); ++i)
+                values[i] = to_int(fields[i]).value_or(0);
+            Bench::do_not_optimize(values.data());
+        });
+
+        runner.run("to_int_batch - span of fields", size, 1, [&] {
+            Bench::do_not_optimize(to_int_batch(fields, values, validity));
+        });
+
+        runner.run("to_int_batch - delimited buffer", size, 1, [&] {
+            Bench::do_not_optimize(to_int_batch(buffer).valid_count);
+        });
+    }
+}
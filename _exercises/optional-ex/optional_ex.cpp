@@ -1,27 +1,10 @@
+#include "to_int.hpp"
+
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
-#include <charconv>
 #include <optional>
 #include <string_view>
 
-
-// TODO
-
-[[nodiscard]] std::optional<int> to_int(std::string_view str)
-{
-    int value;
-
-    auto start = str.data();
-    auto end = str.data() + str.size();
-
-    if (const auto [pos_end, error_code] = std::from_chars(start, end, value); error_code != std::errc{} || pos_end != end)
-    {
-        return std::nullopt;
-    }
-
-    return value;
-}
-
 TEST_CASE("to_int returning optional")
 {
     SECTION("happy path")
@@ -63,4 +46,13 @@ TEST_CASE("to_int returning optional")
             REQUIRE_FALSE(result.has_value());
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("to_number returning optional")
+{
+    REQUIRE(to_number<double>("2.5") == Catch::Approx(2.5));
+    REQUIRE(to_number<long long>("-9000000000") == -9'000'000'000LL);
+    REQUIRE(to_number<unsigned>("-1") == std::nullopt);
+    REQUIRE(to_number<int>("99999999999") == std::nullopt); // out of range
+    REQUIRE(to_number<int>("") == std::nullopt);
+}
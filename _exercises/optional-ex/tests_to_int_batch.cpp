@@ -0,0 +1,172 @@
+#include "to_int_batch.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    const vector<string> tricky_fields = {"", "-", "+1", "0", "-0", "7", "-7", "123", "123a4", "a", " 1", "1 ", "1.5",
+                                          "2147483647", "2147483648", "-2147483648", "-2147483649", "9999999999999999",
+                                          "-9999999999999999", "0000000000000042", "00000000000000000000000000123",
+                                          "12345678901234567", "--1", "1-", "/", ":", "\xff" "1"};
+
+    void require_same_as_to_int(const vector<string>& fields)
+    {
+        const vector<string_view> views(fields.begin(), fields.end());
+        vector<int> values(views.size(), -1);
+        vector<uint64_t> validity((views.size() + 63) / 64, ~uint64_t{0});
+
+        const size_t valid_count = to_int_batch(views, values, validity);
+
+        size_t expected_valid = 0;
+        for (size_t i = 0; i < views.size(); ++i)
+        {
+            const auto expected = to_int(views[i]);
+            INFO("field: '" << fields[i] << "'");
+            REQUIRE(((validity[i / 64] >> (i % 64)) & 1) == expected.has_value());
+            REQUIRE(values[i] == expected.value_or(0));
+            expected_valid += expected.has_value();
+        }
+        REQUIRE(valid_count == expected_valid);
+    }
+}
+
+TEST_CASE("to_int_batch - span of fields")
+{
+    SECTION("edge cases")
+    {
+        require_same_as_to_int(tricky_fields);
+    }
+
+    SECTION("random digit strings with noise")
+    {
+        mt19937_64 rnd_gen(665);
+        uniform_int_distribution<int> length_distribution(0, 20);
+        const string alphabet = "0123456789012345678901234567890123456789-+ a";
+        uniform_int_distribution<size_t> char_distribution(0, alphabet.size() - 1);
+
+        vector<string> fields(10'000);
+        for (auto& field : fields)
+            for (int length = length_distribution(rnd_gen); length > 0; --length)
+                field += alphabet[char_distribution(rnd_gen)];
+
+        require_same_as_to_int(fields);
+    }
+
+    SECTION("every length, each field at the end of its own allocation (no byte past the field is read)")
+    {
+        const string digits = "98765432109876543210";
+
+        vector<unique_ptr<char[]>> storage;
+        vector<string_view> views;
+        for (size_t length = 1; length <= digits.size(); ++length)
+        {
+            for (const string& field : {digits.substr(0, length), string("-").append(digits, 0, length), digits.substr(0, length - 1) + "x"})
+            {
+                storage.push_back(make_unique<char[]>(field.size()));
+                copy(field.begin(), field.end(), storage.back().get());
+                views.emplace_back(storage.back().get(), field.size());
+            }
+        }
+
+        vector<int> values(views.size());
+        vector<uint64_t> validity((views.size() + 63) / 64);
+        to_int_batch(views, values, validity);
+
+        for (size_t i = 0; i < views.size(); ++i)
+        {
+            INFO("field: '" << views[i] << "'");
+            REQUIRE(((validity[i / 64] >> (i % 64)) & 1) == to_int(views[i]).has_value());
+            REQUIRE(values[i] == to_int(views[i]).value_or(0));
+        }
+    }
+
+    SECTION("output spans too small")
+    {
+        const vector<string_view> fields{"1", "2"};
+        vector<int> values(1);
+        vector<uint64_t> validity(1);
+
+        REQUIRE_THROWS_AS(to_int_batch(fields, values, validity), invalid_argument);
+    }
+}
+
+TEST_CASE("to_int_batch - delimited buffer")
+{
+    SECTION("every delimiter separates fields")
+    {
+        const IntColumn column = to_int_batch("1,,-3,123a4,2147483648,42");
+
+        REQUIRE(column.size() == 6);
+        REQUIRE(column.valid_count == 3);
+        REQUIRE(column[0] == 1);
+        REQUIRE(column[1] == nullopt);
+        REQUIRE(column[2] == -3);
+        REQUIRE(column[3] == nullopt);
+        REQUIRE(column[4] == nullopt);
+        REQUIRE(column[5] == 42);
+    }
+
+    SECTION("the same as to_int for every field - numbers close to the end of the buffer")
+    {
+        string buffer;
+        for (const auto& field : tricky_fields)
+            buffer += field + ';';
+        buffer += "5";
+
+        const IntColumn column = to_int_batch(buffer, ';');
+
+        REQUIRE(column.size() == tricky_fields.size() + 1);
+        for (size_t i = 0; i < tricky_fields.size(); ++i)
+            REQUIRE(column[i] == to_int(tricky_fields[i]));
+        REQUIRE(column[tricky_fields.size()] == 5);
+    }
+
+    SECTION("buffers in their own allocation - no byte past the buffer is read")
+    {
+        for (const string text : {"7", "-12", "1,2", "123456789012345", "1234567890123456", "x,99999999,-5", "12,1234567890123456"})
+        {
+            const auto storage = make_unique<char[]>(text.size());
+            copy(text.begin(), text.end(), storage.get());
+
+            const IntColumn column = to_int_batch(string_view(storage.get(), text.size()));
+
+            vector<string> fields(1);
+            for (char c : text)
+            {
+                if (c == ',')
+                    fields.emplace_back();
+                else
+                    fields.back() += c;
+            }
+
+            INFO("buffer: '" << text << "'");
+            REQUIRE(column.size() == fields.size());
+            for (size_t i = 0; i < fields.size(); ++i)
+                REQUIRE(column[i] == to_int(fields[i]));
+        }
+    }
+
+    SECTION("more than 64 fields")
+    {
+        string buffer = "0";
+        for (int i = 1; i < 200; ++i)
+            buffer += (i % 3 == 0 ? ",x" : ",") + to_string(i);
+
+        const IntColumn column = to_int_batch(buffer);
+
+        REQUIRE(column.size() == 200);
+        for (int i = 0; i < 200; ++i)
+            REQUIRE(column[i] == (i % 3 == 0 && i > 0 ? nullopt : optional<int>{i}));
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef TO_INT_HPP
+#define TO_INT_HPP
+
+#include <charconv>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+// Conversions of a whole string_view with std::from_chars - no allocation, no locale, no exceptions:
+//   to_int("123") -> 123, to_int("123a4") -> nullopt (the whole text has to be a number)
+//   to_number<double>("2.5") -> 2.5
+
+template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+[[nodiscard]] std::optional<T> to_number(std::string_view str)
+{
+    T value;
+
+    auto start = str.data();
+    auto end = str.data() + str.size();
+
+    if (const auto [pos_end, error_code] = std::from_chars(start, end, value); error_code != std::errc{} || pos_end != end)
+    {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+[[nodiscard]] inline std::optional<int> to_int(std::string_view str)
+{
+    return to_number<int>(str);
+}
+
+#endif
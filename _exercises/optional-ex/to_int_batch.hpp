@@ -0,0 +1,309 @@
+#ifndef TO_INT_BATCH_HPP
+#define TO_INT_BATCH_HPP
+
+#include "to_int.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define TO_INT_BATCH_HAS_SIMD_KERNELS 1
+#endif
+
+// Many fields converted at once - exactly the results of to_int() (std::from_chars) for every field:
+//   to_int_batch(fields, values, validity) - span of fields -> values[i] (0 if invalid) + bit i of validity
+//   to_int_batch(buffer, ',')              - every delimiter separates fields ("1,,3" - three fields) -> IntColumn
+// Numbers of up to 16 digits are parsed with SSE4.2: 16 digits checked and combined by 4 multiply-adds, no loop per digit;
+// longer ones (leading zeros) go to to_int(). No byte outside the fields (outside the buffer for the delimited form) is read.
+//
+//   const IntColumn column = to_int_batch(line, ';');
+//   for (size_t i = 0; i < column.size(); ++i)
+//       if (auto value = column[i])
+//           ...
+
+struct IntColumn
+{
+    std::vector<int> values;       // 0 for invalid fields
+    std::vector<uint64_t> validity; // bit i - values[i] is a number
+    size_t valid_count = 0;
+
+    size_t size() const
+    {
+        return values.size();
+    }
+
+    bool has_value(size_t index) const
+    {
+        return (validity[index / 64] >> (index % 64)) & 1;
+    }
+
+    std::optional<int> operator[](size_t index) const
+    {
+        return has_value(index) ? std::optional<int>{values[index]} : std::nullopt;
+    }
+};
+
+namespace ToIntBatchDetails
+{
+    inline constexpr size_t max_vector_digits = 16;
+
+    inline bool parse_scalar(std::string_view field, int& value)
+    {
+        const auto result = to_int(field);
+        value = result.value_or(0);
+        return result.has_value();
+    }
+
+    inline void append(IntColumn& column, int value, bool valid)
+    {
+        const size_t index = column.values.size();
+        if (index % 64 == 0)
+            column.validity.push_back(0);
+
+        column.values.push_back(value);
+        column.validity.back() |= uint64_t{valid} << (index % 64);
+        column.valid_count += valid;
+    }
+
+#ifdef TO_INT_BATCH_HAS_SIMD_KERNELS
+    inline bool has_sse42()
+    {
+        static const bool supported = __builtin_cpu_supports("sse4.2");
+        return supported;
+    }
+
+    // PSHUFB masks moving the n digits of a field to the end of the register, zeros in front - one table per way of loading:
+    //   from_start - 16 bytes loaded at the first digit
+    //   from_end   - 16 bytes loaded so that the last digit is the last byte
+    //   chunks     - only bytes of the field: n >= 8 - the first & the last 8 digits (overlapping) in lanes 0..7 & 8..15,
+    //                n >= 4 - the same with 4 digits, n < 4 - digits 0 & n/2 in lanes 0 & 1, the last digit in lane 8
+    struct AlignRightMasks
+    {
+        using Masks = std::array<std::array<uint8_t, 16>, max_vector_digits + 1>;
+
+        alignas(16) Masks from_start{};
+        alignas(16) Masks from_end{};
+        alignas(16) Masks chunks{};
+
+        static constexpr uint8_t chunk_lane(size_t n, size_t digit)
+        {
+            if (n >= 4)
+            {
+                const size_t chunk = n >= 8 ? 8 : 4;
+                return static_cast<uint8_t>(digit < chunk ? digit : 8 + digit - (n - chunk));
+            }
+            return digit == n - 1 ? 8 : digit == 0 ? 0 : 1;
+        }
+
+        constexpr AlignRightMasks()
+        {
+            for (size_t n = 1; n <= max_vector_digits; ++n)
+                for (size_t lane = 0; lane < 16; ++lane)
+                {
+                    const bool is_digit = lane >= 16 - n;
+                    const size_t digit = lane - (16 - n);
+                    from_start[n][lane] = is_digit ? static_cast<uint8_t>(digit) : 0x80;
+                    from_end[n][lane] = is_digit ? static_cast<uint8_t>(lane) : 0x80;
+                    chunks[n][lane] = is_digit ? chunk_lane(n, digit) : 0x80;
+                }
+        }
+    };
+
+    inline constexpr AlignRightMasks align_right_masks{};
+
+    template <typename Chunk>
+    uint64_t load(const char* data)
+    {
+        Chunk chunk;
+        std::memcpy(&chunk, data, sizeof(Chunk));
+        return chunk;
+    }
+
+    // condition ? digits + offset : zeros - computed on integers with masks: no branch the compiler could bring back
+    // and no pointer outside the field is formed when the offset does not apply (n - 8 wraps around for n < 8)
+    inline const char* select(bool condition, const char* digits, size_t offset, const char* zeros)
+    {
+        const uintptr_t mask = uintptr_t{0} - condition;
+        return reinterpret_cast<const char*>(((reinterpret_cast<uintptr_t>(digits) + offset) & mask) | (reinterpret_cast<uintptr_t>(zeros) & ~mask));
+    }
+
+    // the n digits (1..16) as chunks - loads that do not apply to n read from a block of zeros instead;
+    // field lengths are usually mixed, a branch per length class would be mispredicted
+    __attribute__((target("sse4.2"))) inline __m128i load_chunks(const char* digits, size_t n)
+    {
+        alignas(8) static constexpr char zeros[8]{};
+
+        const bool eights = n >= 8;
+        const bool fours = n >= 4 && n < 8;
+        const bool bytes = n < 4;
+
+        const uint64_t first = load<uint64_t>(select(eights, digits, 0, zeros)) | load<uint32_t>(select(fours, digits, 0, zeros))
+                             | load<uint8_t>(select(bytes, digits, 0, zeros)) | load<uint8_t>(select(bytes, digits, n / 2, zeros)) << 8;
+        const uint64_t last = load<uint64_t>(select(eights, digits, n - 8, zeros)) | load<uint32_t>(select(fours, digits, n - 4, zeros))
+                            | load<uint8_t>(select(bytes, digits, n - 1, zeros));
+
+        return _mm_unpacklo_epi64(_mm_cvtsi64_si128(static_cast<long long>(first)), _mm_cvtsi64_si128(static_cast<long long>(last)));
+    }
+
+    // [readable_first, readable_last) - memory around the field the caller guarantees to be readable;
+    // 16 bytes are loaded at once when they fit in it, otherwise only bytes of the field are read
+    __attribute__((target("sse4.2"))) inline bool parse_sse42(std::string_view field, const char* readable_first, const char* readable_last,
+                                                               int& value)
+    {
+        const bool negative = !field.empty() && field.front() == '-';
+        const char* digits = field.data() + negative;
+        const size_t digit_count = field.size() - negative;
+
+        if (digit_count == 0 || digit_count > max_vector_digits)
+            return parse_scalar(field, value);
+
+        __m128i block;
+        const uint8_t* mask;
+        if (readable_last - digits >= 16)
+        {
+            block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+            mask = align_right_masks.from_start[digit_count].data();
+        }
+        else if (digits + digit_count - readable_first >= 16)
+        {
+            block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits + digit_count - 16));
+            mask = align_right_masks.from_end[digit_count].data();
+        }
+        else
+        {
+            block = load_chunks(digits, digit_count);
+            mask = align_right_masks.chunks[digit_count].data();
+        }
+
+        // bytes below '0' wrap around - every non-digit is > 9 after the subtraction; the zeros shuffled in front pass the check
+        const __m128i decimal = _mm_sub_epi8(block, _mm_set1_epi8('0'));
+        const __m128i aligned = _mm_shuffle_epi8(decimal, _mm_load_si128(reinterpret_cast<const __m128i*>(mask)));
+        const unsigned is_digit = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(aligned, _mm_set1_epi8(9)), _mm_setzero_si128()));
+
+        if (is_digit != 0xFFFF)
+        {
+            value = 0;
+            return false;
+        }
+
+        // 16 digits (zero-padded on the left) -> 8 x 2 -> 4 x 4 -> 2 x 8 digits
+        const __m128i pairs = _mm_maddubs_epi16(aligned, _mm_set1_epi16(0x010A));
+        const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00010064));
+        const __m128i octets = _mm_madd_epi16(_mm_packus_epi32(quads, quads), _mm_set1_epi32(0x00012710));
+
+        const uint64_t magnitude = uint64_t{static_cast<uint32_t>(_mm_cvtsi128_si32(octets))} * 100'000'000
+                                 + static_cast<uint32_t>(_mm_extract_epi32(octets, 1));
+
+        const uint64_t limit = negative ? uint64_t{2'147'483'648} : uint64_t{2'147'483'647};
+        if (magnitude > limit) // out of range - as std::from_chars
+        {
+            value = 0;
+            return false;
+        }
+
+        value = static_cast<int>(negative ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude));
+        return true;
+    }
+
+    __attribute__((target("sse4.2"))) inline size_t parse_fields_sse42(std::span<const std::string_view> fields, int* values,
+                                                                         uint64_t* validity)
+    {
+        size_t valid_count = 0;
+        for (size_t i = 0; i < fields.size(); ++i)
+        {
+            const bool valid = parse_sse42(fields[i], fields[i].data(), fields[i].data() + fields[i].size(), values[i]);
+            validity[i / 64] |= uint64_t{valid} << (i % 64);
+            valid_count += valid;
+        }
+        return valid_count;
+    }
+
+    __attribute__((target("sse4.2"))) inline void parse_buffer_sse42(std::string_view buffer, char delimiter, IntColumn& column)
+    {
+        const char* readable_first = buffer.data();
+        const char* readable_last = buffer.data() + buffer.size();
+
+        for (size_t start = 0;;)
+        {
+            const size_t end = std::min(buffer.find(delimiter, start), buffer.size());
+
+            int value;
+            const bool valid = parse_sse42(buffer.substr(start, end - start), readable_first, readable_last, value);
+            append(column, value, valid);
+
+            if (end == buffer.size())
+                break;
+            start = end + 1;
+        }
+    }
+#endif
+
+    inline size_t parse_fields_scalar(std::span<const std::string_view> fields, int* values, uint64_t* validity)
+    {
+        size_t valid_count = 0;
+        for (size_t i = 0; i < fields.size(); ++i)
+        {
+            const bool valid = parse_scalar(fields[i], values[i]);
+            validity[i / 64] |= uint64_t{valid} << (i % 64);
+            valid_count += valid;
+        }
+        return valid_count;
+    }
+
+    inline void parse_buffer_scalar(std::string_view buffer, char delimiter, IntColumn& column)
+    {
+        for (size_t start = 0;;)
+        {
+            const size_t end = std::min(buffer.find(delimiter, start), buffer.size());
+
+            int value;
+            const bool valid = parse_scalar(buffer.substr(start, end - start), value);
+            append(column, value, valid);
+
+            if (end == buffer.size())
+                break;
+            start = end + 1;
+        }
+    }
+}
+
+// values.size() >= fields.size(), validity.size() >= (fields.size() + 63) / 64 - returns the number of valid fields
+inline size_t to_int_batch(std::span<const std::string_view> fields, std::span<int> values, std::span<uint64_t> validity)
+{
+    if (values.size() < fields.size() || validity.size() < (fields.size() + 63) / 64)
+        throw std::invalid_argument("to_int_batch: output spans are too small");
+
+    std::fill(validity.begin(), validity.begin() + (fields.size() + 63) / 64, 0);
+
+#ifdef TO_INT_BATCH_HAS_SIMD_KERNELS
+    if (ToIntBatchDetails::has_sse42())
+        return ToIntBatchDetails::parse_fields_sse42(fields, values.data(), validity.data());
+#endif
+    return ToIntBatchDetails::parse_fields_scalar(fields, values.data(), validity.data());
+}
+
+inline IntColumn to_int_batch(std::string_view buffer, char delimiter = ',')
+{
+    IntColumn column;
+
+#ifdef TO_INT_BATCH_HAS_SIMD_KERNELS
+    if (ToIntBatchDetails::has_sse42())
+    {
+        ToIntBatchDetails::parse_buffer_sse42(buffer, delimiter, column);
+        return column;
+    }
+#endif
+    ToIntBatchDetails::parse_buffer_scalar(buffer, delimiter, column);
+    return column;
+}
+
+#endif
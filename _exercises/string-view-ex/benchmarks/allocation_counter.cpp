@@ -0,0 +1,54 @@
+#include "allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<size_t> allocation_count{0};
+
+    // one relaxed increment - negligible next to malloc itself
+    void* allocate(std::size_t size)
+    {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        if (void* memory = std::malloc(size == 0 ? 1 : size))
+            return memory;
+        throw std::bad_alloc{};
+    }
+}
+
+size_t AllocationCounter::count()
+{
+    return allocation_count.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
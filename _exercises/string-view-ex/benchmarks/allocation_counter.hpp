@@ -0,0 +1,16 @@
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+
+// Every operator new of the benchmark executable is counted - the replacement operators live in allocation_counter.cpp,
+// a translation unit of their own, so they are never inlined into the code they count
+// (an inlined free() next to an operator new the compiler cannot see is reported as a mismatched new/delete)
+
+namespace AllocationCounter
+{
+    // operator new / new[] calls since the start of the program
+    size_t count();
+}
+
+#endif
@@ -0,0 +1,89 @@
+#include <bench.hpp>
+#include <csv_reader.hpp>
+#include <mapped_file.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    // id,price,stock,comment - every 10th stock empty, every 20th comment quoted with a comma
+    std::filesystem::path make_csv_file(size_t size)
+    {
+        const auto path = std::filesystem::temp_directory_path() / ("csv_reader_bench_" + std::to_string(size) + ".csv");
+
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<int> stock_distribution(0, 10'000);
+        std::uniform_int_distribution<int> cents_distribution(1, 1'000'000);
+
+        std::ofstream out(path, std::ios::binary);
+        out << "id,price,stock,comment\n";
+
+        std::string line;
+        size_t written = 0;
+        for (int id = 1; written < size; ++id)
+        {
+            line = std::to_string(id) + ',' + std::to_string(cents_distribution(rnd_gen) / 100.0) + ',';
+            if (id % 10 != 0)
+                line += std::to_string(stock_distribution(rnd_gen));
+            line += id % 20 == 0 ? ",\"restocked, see notes\"\n" : ",ok\n";
+
+            out << line;
+            written += line.size();
+        }
+
+        return path;
+    }
+}
+
+// throughput column = MB/s; a multi-GB file: --filter CsvReader --sizes 4G
+BENCHMARK_SUITE("CsvReader - typed columns from a file")
+{
+    for (auto size : runner.sizes({10'000'000, 100'000'000}))
+    {
+        const auto path = make_csv_file(size);
+
+        runner.run("ifstream + getline + stod/stoi", size, 1, [&] {
+            std::ifstream in(path, std::ios::binary);
+            std::vector<int> ids;
+            std::vector<double> prices;
+            std::vector<std::optional<int>> stock;
+
+            std::string line, field;
+            std::getline(in, line);
+            while (std::getline(in, line))
+            {
+                std::istringstream fields(line);
+                std::getline(fields, field, ',');
+                ids.push_back(std::stoi(field));
+                std::getline(fields, field, ',');
+                prices.push_back(std::stod(field));
+                std::getline(fields, field, ',');
+                stock.push_back(field.empty() ? std::nullopt : std::optional<int>(std::stoi(field)));
+            }
+            Bench::do_not_optimize(ids.data());
+        });
+
+        runner.run("MappedFile + CsvReader (fields only)", size, 1, [&] {
+            MappedFile file{path.string()};
+            CsvReader reader{file.view(), {.header = true}};
+            size_t fields = 0;
+            for (const auto& row : reader)
+                fields += row.size();
+            Bench::do_not_optimize(fields);
+        });
+
+        runner.run("MappedFile + read_columns<int, double, optional<int>>", size, 1, [&] {
+            MappedFile file{path.string()};
+            auto columns = read_columns<int, double, std::optional<int>>(file.view(), {.header = true});
+            Bench::do_not_optimize(std::get<0>(columns).data());
+        });
+
+        std::filesystem::remove(path);
+    }
+}
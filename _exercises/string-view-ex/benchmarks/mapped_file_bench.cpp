@@ -0,0 +1,78 @@
+#include <bench.hpp>
+#include <mapped_file.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    // log-like file: lines of 4-10 space separated fields
+    std::filesystem::path make_log_file(size_t size)
+    {
+        const auto path = std::filesystem::temp_directory_path() / ("mapped_file_bench_" + std::to_string(size) + ".log");
+
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<int> field_count_distribution(4, 10);
+        std::uniform_int_distribution<int> letter_distribution('a', 'z');
+
+        std::ofstream out(path, std::ios::binary);
+        size_t written = 0;
+        while (written < size)
+        {
+            std::string line;
+            for (int field = field_count_distribution(rnd_gen); field > 0; --field)
+            {
+                line.append(static_cast<size_t>(letter_distribution(rnd_gen) % 8 + 1), static_cast<char>(letter_distribution(rnd_gen)));
+                line += field > 1 ? ' ' : '\n';
+            }
+            out << line;
+            written += line.size();
+        }
+
+        return path;
+    }
+
+    size_t count_fields(std::string_view text)
+    {
+        size_t fields = 0;
+        for (std::string_view line : split_any_of(text, "\n"))
+            for ([[maybe_unused]] std::string_view field : split_any_of(line, " "))
+                ++fields;
+        return fields;
+    }
+}
+
+BENCHMARK_SUITE("MappedFile vs. reading into std::string")
+{
+    for (auto size : runner.sizes({10'000'000, 100'000'000}))
+    {
+        const auto path = make_log_file(size);
+
+        runner.run("ifstream -> std::string + split_any_of", size, 1, [&] {
+            std::ifstream in(path, std::ios::binary);
+            std::ostringstream content;
+            content << in.rdbuf();
+            Bench::do_not_optimize(count_fields(content.str()));
+        });
+
+        runner.run("MappedFile + split_any_of", size, 1, [&] {
+            MappedFile file{path.string()};
+            Bench::do_not_optimize(count_fields(file.view()));
+        });
+
+        runner.run("MappedFile::records", size, 1, [&] {
+            MappedFile file{path.string()};
+            size_t fields = 0;
+            for (auto record : file.records(" "))
+                fields += std::ranges::distance(record);
+            Bench::do_not_optimize(fields);
+        });
+
+        std::filesystem::remove(path);
+    }
+}
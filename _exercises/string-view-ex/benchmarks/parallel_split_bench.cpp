@@ -0,0 +1,56 @@
+#include <bench.hpp>
+#include <parallel_split.hpp>
+
+#include <execution>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <tbb/global_control.h>
+
+namespace
+{
+    // lines of space separated words
+    std::string make_text(size_t size)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::string text(size, ' ');
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            const auto bits = rnd_gen();
+            text[i] = (bits % 7 == 0) ? ' ' : (bits % 101 == 0) ? '\n' : static_cast<char>('a' + (bits >> 8) % 26);
+        }
+
+        return text;
+    }
+}
+
+BENCHMARK_SUITE("split_text - parallel chunks")
+{
+    for (auto size : runner.sizes({100'000'000, 1'000'000'000}))
+    {
+        const auto text = make_text(size);
+
+        runner.run("split_text", size, 1, [&] {
+            Bench::do_not_optimize(split_text(text, " \n"));
+        });
+
+        runner.run("Simd::split_text", size, 1, [&] {
+            Bench::do_not_optimize(Simd::split_text(text, " \n"));
+        });
+
+        for (auto threads : runner.thread_counts())
+        {
+            tbb::global_control limit{tbb::global_control::max_allowed_parallelism, threads};
+
+            runner.run("split_text/par", size, threads, [&] {
+                Bench::do_not_optimize(split_text(std::execution::par, text, " \n"));
+            });
+
+            runner.run("split_text_chunks/par", size, threads, [&] {
+                Bench::do_not_optimize(split_text_chunks(std::execution::par, text, " \n"));
+            });
+        }
+    }
+}
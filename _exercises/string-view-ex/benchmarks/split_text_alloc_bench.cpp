@@ -0,0 +1,106 @@
+#include "allocation_counter.hpp"
+
+#include <bench.hpp>
+#include <split_text.hpp>
+
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // CSV-like lines of 5-15 fields
+    std::vector<std::string> make_lines(size_t count)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<int> field_count_distribution(5, 15);
+        std::uniform_int_distribution<int> length_distribution(1, 10);
+
+        std::vector<std::string> lines(count);
+        for (auto& line : lines)
+        {
+            for (int field = field_count_distribution(rnd_gen); field > 0; --field)
+            {
+                line.append(static_cast<size_t>(length_distribution(rnd_gen)), 'x');
+                line += field > 1 ? ", " : "";
+            }
+        }
+
+        return lines;
+    }
+
+    // operator new calls made by f()
+    template <typename Function>
+    double count_allocations(Function f)
+    {
+        const size_t before = AllocationCounter::count();
+        f();
+        return static_cast<double>(AllocationCounter::count() - before);
+    }
+
+    // stored as a counter (JSON/CSV) and printed per line
+    void report_allocations(Bench::Result& result, double allocations)
+    {
+        result.counter("allocations", allocations);
+        std::cout << "    allocations/line " << std::setprecision(3) << allocations / static_cast<double>(result.size) << "\n";
+    }
+
+    constexpr size_t lines_per_batch = 256;
+}
+
+BENCHMARK_SUITE("split_text - allocations per line")
+{
+    for (auto size : runner.sizes({100'000, 1'000'000}))
+    {
+        const auto lines = make_lines(size);
+
+        auto fresh_vectors = [&] {
+            size_t tokens = 0;
+            for (const auto& line : lines)
+                tokens += split_text(line).size();
+            Bench::do_not_optimize(tokens);
+        };
+
+        std::vector<std::string_view> reused_tokens;
+        auto reused_vector = [&] {
+            size_t tokens = 0;
+            for (const auto& line : lines)
+                tokens += split_text_into(reused_tokens, line).size();
+            Bench::do_not_optimize(tokens);
+        };
+
+        auto reused_vector_simd = [&] {
+            size_t tokens = 0;
+            for (const auto& line : lines)
+                tokens += Simd::split_text_into(reused_tokens, line).size();
+            Bench::do_not_optimize(tokens);
+        };
+
+        // the arena's first block lives in the buffer - released after every batch of lines
+        std::vector<std::byte> arena_buffer(lines_per_batch * 1024);
+        auto monotonic_arena = [&] {
+            std::pmr::monotonic_buffer_resource arena{arena_buffer.data(), arena_buffer.size()};
+            size_t tokens = 0;
+            for (size_t i = 0; i < lines.size(); ++i)
+            {
+                tokens += split_text(lines[i], ", ", &arena).size();
+                if ((i + 1) % lines_per_batch == 0)
+                    arena.release();
+            }
+            Bench::do_not_optimize(tokens);
+        };
+
+        report_allocations(runner.run("split_text - new vector per line", size, 1, fresh_vectors), count_allocations(fresh_vectors));
+
+        report_allocations(runner.run("split_text_into - reused vector", size, 1, reused_vector), count_allocations(reused_vector));
+
+        report_allocations(runner.run("Simd::split_text_into - reused vector", size, 1, reused_vector_simd), count_allocations(reused_vector_simd));
+
+        report_allocations(runner.run("split_text - pmr monotonic arena", size, 1, monotonic_arena), count_allocations(monotonic_arena));
+    }
+}
@@ -0,0 +1,77 @@
+#include <bench.hpp>
+#include <split_text.hpp>
+
+#include <random>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    // log-like lines: words of 1-12 letters separated by single spaces
+    std::string make_text(size_t size)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<size_t> length_distribution(1, 12);
+        std::uniform_int_distribution<int> letter_distribution('a', 'z');
+
+        std::string text;
+        text.reserve(size + 16);
+
+        while (text.size() < size)
+        {
+            for (size_t length = length_distribution(rnd_gen); length > 0; --length)
+                text += static_cast<char>(letter_distribution(rnd_gen));
+            text += ' ';
+        }
+
+        text.resize(size);
+        return text;
+    }
+}
+
+BENCHMARK_SUITE("split_text - delimiter scanning")
+{
+    for (auto size : runner.sizes({1'000, 1'000'000, 100'000'000}))
+    {
+        const auto text = make_text(size);
+
+        runner.run("split_text", size, 1, [&] {
+            Bench::do_not_optimize(split_text(text, " "));
+        });
+
+        runner.run("Cpp20::split_text", size, 1, [&] {
+            Bench::do_not_optimize(Cpp20::split_text(text, " "));
+        });
+
+        for (auto kernel : {Simd::Kernel::scalar, Simd::Kernel::sse42, Simd::Kernel::avx2})
+        {
+            if (!Simd::is_supported(kernel))
+                continue;
+
+            const char* kernel_names[] = {"scalar", "sse4.2", "avx2"};
+
+            runner.run(std::string("Simd::split_text/") + kernel_names[static_cast<int>(kernel)], size, 1, [&] {
+                Bench::do_not_optimize(Simd::split_text(text, " ", kernel));
+            });
+        }
+
+        runner.run("split_any_of - lazy, no vector", size, 1, [&] {
+            size_t total_length = 0;
+            for (std::string_view token : split_any_of(text, " "))
+                total_length += token.size();
+            Bench::do_not_optimize(total_length);
+        });
+
+        runner.run("split_any_of - first 10 tokens", size, 1, [&] {
+            size_t total_length = 0;
+            for (std::string_view token : split_any_of(text, " ") | std::views::take(10))
+                total_length += token.size();
+            Bench::do_not_optimize(total_length);
+        });
+
+        runner.run("Simd::split_text/5 delimiters", size, 1, [&] {
+            Bench::do_not_optimize(Simd::split_text(text, " ,;\t\n"));
+        });
+    }
+}
@@ -0,0 +1,86 @@
+#include <bench.hpp>
+#include <utf8.hpp>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // words separated by ", " - every non_ascii_every-th word is Polish with diacritics (0 - ASCII only)
+    std::string make_text(size_t size, int non_ascii_every)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<size_t> length_distribution(1, 12);
+        std::uniform_int_distribution<int> letter_distribution('a', 'z');
+        std::uniform_int_distribution<int> word_distribution(1, non_ascii_every > 0 ? non_ascii_every : 1);
+
+        std::string text;
+        text.reserve(size + 32);
+
+        while (text.size() < size)
+        {
+            if (non_ascii_every > 0 && word_distribution(rnd_gen) == 1)
+                text += "zażółć";
+            else
+                for (size_t length = length_distribution(rnd_gen); length > 0; --length)
+                    text += static_cast<char>(letter_distribution(rnd_gen));
+            text += ", ";
+        }
+
+        text.resize(size);
+        while (!Utf8::is_valid(text)) // resize may cut a code point
+            text.pop_back();
+        return text;
+    }
+}
+
+BENCHMARK_SUITE("Utf8 - validation")
+{
+    for (auto size : runner.sizes({1'000'000, 100'000'000}))
+    {
+        for (int non_ascii_every : {0, 20})
+        {
+            const auto text = make_text(size, non_ascii_every);
+            const std::string suffix = non_ascii_every == 0 ? " (ASCII)" : " (5% Polish)";
+
+            runner.run("find_invalid_scalar" + suffix, text.size(), 1, [&] {
+                Bench::do_not_optimize(Utf8::Details::find_invalid_scalar(text));
+            });
+
+            runner.run("Utf8::find_invalid" + suffix, text.size(), 1, [&] {
+                Bench::do_not_optimize(Utf8::find_invalid(text));
+            });
+        }
+    }
+}
+
+BENCHMARK_SUITE("Utf8 - validate & split")
+{
+    for (auto size : runner.sizes({1'000'000, 100'000'000}))
+    {
+        for (int non_ascii_every : {0, 20})
+        {
+            const auto text = make_text(size, non_ascii_every);
+            const std::string suffix = non_ascii_every == 0 ? " (ASCII)" : " (5% Polish)";
+
+            runner.run("Simd::split_text - bytes, no validation" + suffix, text.size(), 1, [&] {
+                Bench::do_not_optimize(Simd::split_text(text, ", "));
+            });
+
+            runner.run("is_valid + Simd::split_text - two passes" + suffix, text.size(), 1, [&] {
+                if (Utf8::is_valid(text))
+                    Bench::do_not_optimize(Simd::split_text(text, ", "));
+            });
+
+            runner.run("Utf8::split_text - one pass" + suffix, text.size(), 1, [&] {
+                Bench::do_not_optimize(Utf8::split_text(text, ", "));
+            });
+
+            runner.run("Utf8::split_text - multi-byte delimiter" + suffix, text.size(), 1, [&] {
+                Bench::do_not_optimize(Utf8::split_text(text, ",—"));
+            });
+        }
+    }
+}
@@ -0,0 +1,325 @@
+#ifndef CSV_READER_HPP
+#define CSV_READER_HPP
+
+#include "token_range.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <to_int.hpp>
+
+// Delimited records (RFC 4180 CSV) read straight from a string_view - e.g. MappedFile::view():
+//   - fields are std::string_view into the text; a row without quotes is split by split_on(line, ",")
+//   - quoted fields may contain delimiters, line breaks and doubled quotes ("" -> ");
+//     only a field with doubled quotes is copied (to a per-row buffer)
+//   - "\r\n" line ends are accepted, blank lines are skipped
+//
+//   CsvReader reader{file.view(), {.header = true}};
+//   for (const auto& fields : reader)
+//       total += to_int(fields[2]).value_or(0);
+//
+//   auto [ids, prices, stock] = read_columns<int, double, std::optional<int>>(file.view(), {.header = true});
+// Views of the current row are valid until the next row is read (unescaped fields) or as long as the text lives (others).
+
+struct CsvDialect
+{
+    char delimiter = ',';
+    char quote = '"';
+    bool header = false; // the first row is skipped
+};
+
+class CsvReader
+{
+public:
+    class iterator
+    {
+        CsvReader* reader_ = nullptr;
+
+    public:
+        using value_type = std::vector<std::string_view>;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        explicit iterator(CsvReader& reader)
+            : reader_{&reader}
+        {
+        }
+
+        const std::vector<std::string_view>& operator*() const
+        {
+            return reader_->fields();
+        }
+
+        iterator& operator++()
+        {
+            reader_->read_row();
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        bool at_end() const
+        {
+            return reader_->done_;
+        }
+
+        friend bool operator==(const iterator& it, std::default_sentinel_t)
+        {
+            return it.at_end();
+        }
+    };
+
+    explicit CsvReader(std::string_view text, CsvDialect dialect = {})
+        : text_{text}
+        , dialect_{dialect}
+    {
+        if (dialect_.header)
+            read_row();
+    }
+
+    // false (and no fields) after the last row
+    bool read_row()
+    {
+        fields_.clear();
+
+        while (position_ < text_.size())
+        {
+            const size_t line_end = std::min(text_.find('\n', position_), text_.size());
+            std::string_view line = text_.substr(position_, line_end - position_);
+            if (!line.empty() && line.back() == '\r')
+                line.remove_suffix(1);
+
+            row_line_ = ++line_;
+
+            if (line.empty())
+            {
+                position_ = line_end + 1;
+                continue;
+            }
+
+            if (line.find(dialect_.quote) == std::string_view::npos)
+            {
+                for (std::string_view field : split_on(line, std::string_view(&dialect_.delimiter, 1)))
+                    fields_.push_back(field);
+                position_ = line_end + 1;
+            }
+            else
+            {
+                read_quoted_row();
+            }
+
+            ++row_count_;
+            return true;
+        }
+
+        done_ = true;
+        return false;
+    }
+
+    const std::vector<std::string_view>& fields() const
+    {
+        return fields_;
+    }
+
+    // rows returned so far - the header is not counted
+    size_t row_count() const
+    {
+        return row_count_ - (dialect_.header && row_count_ > 0 ? 1 : 0);
+    }
+
+    // 1-based line where the current row starts
+    size_t line() const
+    {
+        return row_line_;
+    }
+
+    // reads the next row - the reader is an input range, it can be iterated once
+    iterator begin()
+    {
+        read_row();
+        return iterator{*this};
+    }
+
+    std::default_sentinel_t end() const
+    {
+        return std::default_sentinel;
+    }
+
+private:
+    // quote-aware scan of one row starting at position_ - it may span several lines
+    void read_quoted_row()
+    {
+        const char delimiter = dialect_.delimiter;
+        const char quote = dialect_.quote;
+        const size_t row_begin = position_;
+        const size_t size = text_.size();
+
+        struct Unescaped
+        {
+            size_t field, offset, length;
+        };
+        std::vector<Unescaped> unescaped_fields;
+        unescaped_.clear();
+
+        size_t i = position_;
+        while (true)
+        {
+            if (i < size && text_[i] == quote)
+            {
+                const size_t content_begin = ++i;
+                std::optional<size_t> unescaped_offset;
+
+                while (true)
+                {
+                    const size_t closing = text_.find(quote, i);
+                    if (closing == std::string_view::npos)
+                        throw std::runtime_error("CsvReader: unterminated quoted field in line " + std::to_string(row_line_));
+
+                    const bool doubled = closing + 1 < size && text_[closing + 1] == quote;
+
+                    if (doubled && !unescaped_offset)
+                        unescaped_offset = unescaped_.size();
+
+                    if (unescaped_offset)
+                        unescaped_.append(text_.substr(i, closing - i + (doubled ? 1 : 0)));
+
+                    if (!doubled)
+                    {
+                        if (unescaped_offset)
+                            unescaped_fields.push_back({fields_.size(), *unescaped_offset, unescaped_.size() - *unescaped_offset});
+                        fields_.push_back(text_.substr(content_begin, closing - content_begin));
+                        i = closing + 1;
+                        break;
+                    }
+
+                    i = closing + 2;
+                }
+
+                if (i < size && text_[i] == '\r')
+                    ++i;
+            }
+            else // unquoted - quotes inside are ordinary characters
+            {
+                size_t end = i;
+                while (end < size && text_[end] != delimiter && text_[end] != '\n')
+                    ++end;
+
+                size_t length = end - i;
+                if (end < size && text_[end] == '\n' && length > 0 && text_[end - 1] == '\r')
+                    --length;
+
+                fields_.push_back(text_.substr(i, length));
+                i = end;
+            }
+
+            if (i >= size)
+            {
+                position_ = size;
+                break;
+            }
+
+            if (text_[i] == delimiter)
+            {
+                ++i;
+                continue;
+            }
+
+            if (text_[i] == '\n')
+            {
+                position_ = i + 1;
+                break;
+            }
+
+            throw std::runtime_error("CsvReader: unexpected character after a quoted field in line " + std::to_string(row_line_));
+        }
+
+        // unescaped_ does not grow any more - views into it are stable until the next row
+        for (const auto& field : unescaped_fields)
+            fields_[field.field] = std::string_view(unescaped_).substr(field.offset, field.length);
+
+        line_ += std::count(text_.begin() + row_begin, text_.begin() + std::min(position_, size), '\n');
+        line_ -= (position_ > row_begin && text_[position_ - 1] == '\n') ? 1 : 0; // the row's own line end is already counted
+    }
+
+    std::string_view text_;
+    CsvDialect dialect_;
+    size_t position_ = 0;
+    size_t line_ = 0;     // lines consumed
+    size_t row_line_ = 0; // line where the current row starts
+    size_t row_count_ = 0;
+    bool done_ = false;
+    std::vector<std::string_view> fields_;
+    std::string unescaped_;
+};
+
+namespace CsvDetails
+{
+    template <typename T>
+    struct Column
+    {
+        static T convert(std::string_view field, const CsvReader& reader, size_t column)
+        {
+            if (auto value = to_number<T>(field))
+                return *value;
+
+            throw std::invalid_argument("read_columns: invalid value '" + std::string(field) + "' in line " + std::to_string(reader.line()) +
+                                        ", column " + std::to_string(column + 1));
+        }
+
+        static T missing(const CsvReader& reader, size_t column)
+        {
+            throw std::invalid_argument("read_columns: missing column " + std::to_string(column + 1) + " in line " +
+                                        std::to_string(reader.line()));
+        }
+    };
+
+    // empty, invalid or missing fields -> nullopt
+    template <typename T>
+    struct Column<std::optional<T>>
+    {
+        static std::optional<T> convert(std::string_view field, const CsvReader&, size_t)
+        {
+            return to_number<T>(field);
+        }
+
+        static std::optional<T> missing(const CsvReader&, size_t)
+        {
+            return std::nullopt;
+        }
+    };
+}
+
+// the first sizeof...(Columns) fields of every row converted to typed columns - fields after them are ignored
+template <typename... Columns>
+std::tuple<std::vector<Columns>...> read_columns(std::string_view text, CsvDialect dialect = {})
+{
+    std::tuple<std::vector<Columns>...> columns;
+    CsvReader reader{text, dialect};
+
+    while (reader.read_row())
+    {
+        const auto& fields = reader.fields();
+
+        [&]<size_t... Index>(std::index_sequence<Index...>) {
+            (std::get<Index>(columns).push_back(Index < fields.size() ? CsvDetails::Column<Columns>::convert(fields[Index], reader, Index)
+                                                                      : CsvDetails::Column<Columns>::missing(reader, Index)),
+             ...);
+        }(std::index_sequence_for<Columns...>{});
+    }
+
+    return columns;
+}
+
+#endif
@@ -0,0 +1,225 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include "token_range.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Read-only memory-mapped file exposed as std::string_view - no copy of the content into a std::string.
+// Every string_view obtained from the file (lines, fields) stays valid as long as the mapping lives;
+// moving a MappedFile keeps the mapping at the same address.
+// POSIX: mmap + madvise; Windows: CreateFileMapping + MapViewOfFile (the advice becomes a CreateFile access hint).
+//
+//   MappedFile log{"server.log"};                        // MADV_SEQUENTIAL by default
+//   for (std::string_view line : log.lines())
+//       for (std::string_view field : split_any_of(line, " \t"))
+//           ...
+
+class MappedFile
+{
+public:
+    enum class Advice
+    {
+        normal,
+        sequential,
+        random,
+        will_need
+    };
+
+    explicit MappedFile(const std::string& path, Advice advice = Advice::sequential)
+    {
+        map(path, advice);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)}
+        , size_{std::exchange(other.size_, 0)}
+    {
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    ~MappedFile()
+    {
+        unmap();
+    }
+
+    // a hint for the kernel's read-ahead - errors are ignored (no-op on Windows, where the hint is given when opening)
+    void advise([[maybe_unused]] Advice advice) const
+    {
+#ifndef _WIN32
+        if (data_ == nullptr)
+            return;
+
+        static constexpr int advices[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED};
+        ::madvise(const_cast<char*>(data_), size_, advices[static_cast<int>(advice)]);
+#endif
+    }
+
+    std::string_view view() const
+    {
+        return std::string_view(data_, size_);
+    }
+
+    const char* data() const
+    {
+        return data_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    // non-empty lines ("\n" or "\r\n" terminated) - runs of line breaks are one separator (split_text semantics)
+    auto lines() const
+    {
+        return split_any_of(view(), "\r\n") | std::views::filter([](std::string_view line) { return !line.empty(); });
+    }
+
+    // every line as a range of fields - delimiters must outlive the returned range
+    auto records(std::string_view delimiters = ", ") const
+    {
+        return lines() | std::views::transform([delimiters](std::string_view line) { return split_any_of(line, delimiters); });
+    }
+
+private:
+#ifdef _WIN32
+    void map(const std::string& path, Advice advice)
+    {
+        const DWORD access_hint = advice == Advice::sequential ? FILE_FLAG_SEQUENTIAL_SCAN
+                                : advice == Advice::random     ? FILE_FLAG_RANDOM_ACCESS
+                                                               : FILE_ATTRIBUTE_NORMAL;
+
+        const HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, access_hint, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            throw std::system_error(static_cast<int>(::GetLastError()), std::system_category(), "cannot open " + path);
+
+        LARGE_INTEGER file_size{};
+        if (!::GetFileSizeEx(file, &file_size))
+        {
+            const DWORD error = ::GetLastError();
+            ::CloseHandle(file);
+            throw std::system_error(static_cast<int>(error), std::system_category(), "cannot stat " + path);
+        }
+
+        size_ = static_cast<size_t>(file_size.QuadPart);
+
+        if (size_ > 0) // a mapping of an empty file fails - an empty file is an empty view
+        {
+            const HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            const DWORD error = ::GetLastError();
+            ::CloseHandle(file); // the mapping keeps the file referenced
+
+            if (mapping == nullptr)
+                throw std::system_error(static_cast<int>(error), std::system_category(), "cannot map " + path);
+
+            const void* address = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            const DWORD view_error = ::GetLastError();
+            ::CloseHandle(mapping); // the view keeps the mapping referenced
+
+            if (address == nullptr)
+                throw std::system_error(static_cast<int>(view_error), std::system_category(), "cannot map " + path);
+
+            data_ = static_cast<const char*>(address);
+        }
+        else
+        {
+            ::CloseHandle(file);
+        }
+    }
+
+    void unmap()
+    {
+        if (data_ != nullptr)
+            ::UnmapViewOfFile(data_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+#else
+    void map(const std::string& path, Advice advice)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), "cannot open " + path);
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "cannot stat " + path);
+        }
+
+        size_ = static_cast<size_t>(info.st_size);
+
+        if (size_ > 0) // mmap of zero bytes fails - an empty file is an empty view
+        {
+            void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            const int error = errno;
+            ::close(fd); // the mapping keeps the file referenced
+
+            if (address == MAP_FAILED)
+                throw std::system_error(error, std::generic_category(), "cannot map " + path);
+
+            data_ = static_cast<const char*>(address);
+            advise(advice);
+        }
+        else
+        {
+            ::close(fd);
+        }
+    }
+
+    void unmap()
+    {
+        if (data_ != nullptr)
+            ::munmap(const_cast<char*>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+#endif
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+#endif
@@ -0,0 +1,120 @@
+#ifndef PARALLEL_SPLIT_HPP
+#define PARALLEL_SPLIT_HPP
+
+#include "split_text.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+// split_text(std::execution::par, text, pattern) - the same tokens as split_text(text, pattern) for huge texts:
+//   - the text is cut into chunks at the ends of delimiter runs, so no token (and no delimiter run) spans two chunks
+//   - chunks are tokenized by Simd::split_text on TBB workers and concatenated in order
+// split_text_chunks(std::execution::par, text, pattern) - per-chunk token vectors without the final concatenation
+
+namespace ParallelSplitDetails
+{
+    inline constexpr size_t min_chunk_size = 1024 * 1024;
+    inline constexpr size_t max_chunks = 1024;
+
+    // chunk boundaries 0 = cuts[0] < cuts[1] < ... < cuts[n] = text.size(); every inner cut is the end of a delimiter run
+    inline std::vector<size_t> find_cuts(std::string_view text, std::string_view pattern, size_t chunk_size)
+    {
+        std::vector<size_t> cuts{0};
+
+        for (size_t nominal = chunk_size; nominal < text.size(); nominal += chunk_size)
+        {
+            const size_t delimiter = std::min(text.find_first_of(pattern, std::max(nominal, cuts.back())), text.size());
+            const size_t cut = std::min(text.find_first_not_of(pattern, delimiter), text.size());
+
+            if (cut == text.size())
+                break;
+
+            if (cut > cuts.back())
+                cuts.push_back(cut);
+        }
+
+        cuts.push_back(text.size());
+        return cuts;
+    }
+
+    inline std::vector<std::vector<std::string_view>> split_chunks(std::string_view text, std::string_view pattern, size_t chunk_size)
+    {
+        if (pattern.empty() || text.size() <= chunk_size)
+            return {Simd::split_text(text, pattern)};
+
+        const auto cuts = find_cuts(text, pattern, chunk_size);
+        const size_t chunk_count = cuts.size() - 1;
+
+        std::vector<std::vector<std::string_view>> chunks(chunk_count);
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, chunk_count, 1), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t chunk = range.begin(); chunk != range.end(); ++chunk)
+            {
+                const std::string_view chunk_text = text.substr(cuts[chunk], cuts[chunk + 1] - cuts[chunk]);
+                chunks[chunk] = Simd::split_text(chunk_text, pattern);
+
+                if (chunk + 1 < chunk_count) // ends with a delimiter run - its empty last token is not a token of the text
+                    chunks[chunk].pop_back();
+            }
+        });
+
+        return chunks;
+    }
+
+    inline std::vector<std::string_view> concatenate(const std::vector<std::vector<std::string_view>>& chunks)
+    {
+        std::vector<size_t> offsets(chunks.size() + 1, 0);
+        for (size_t chunk = 0; chunk < chunks.size(); ++chunk)
+            offsets[chunk + 1] = offsets[chunk] + chunks[chunk].size();
+
+        std::vector<std::string_view> tokens(offsets.back());
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, chunks.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t chunk = range.begin(); chunk != range.end(); ++chunk)
+                std::copy(chunks[chunk].begin(), chunks[chunk].end(), tokens.begin() + offsets[chunk]);
+        });
+
+        return tokens;
+    }
+
+    inline size_t chunk_size_for(size_t text_size)
+    {
+        return std::max(min_chunk_size, (text_size + max_chunks - 1) / max_chunks);
+    }
+
+    template <typename ExecutionPolicy>
+    inline constexpr bool is_sequenced = std::is_same_v<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy>;
+}
+
+template <typename ExecutionPolicy, typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+std::vector<std::vector<std::string_view>> split_text_chunks(ExecutionPolicy&&, std::string_view text, std::string_view pattern = ", ")
+{
+    if constexpr (ParallelSplitDetails::is_sequenced<ExecutionPolicy>)
+        return {split_text(text, pattern)};
+    else
+        return ParallelSplitDetails::split_chunks(text, pattern, ParallelSplitDetails::chunk_size_for(text.size()));
+}
+
+template <typename ExecutionPolicy, typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+std::vector<std::string_view> split_text(ExecutionPolicy&& policy, std::string_view text, std::string_view pattern = ", ")
+{
+    if constexpr (ParallelSplitDetails::is_sequenced<ExecutionPolicy>)
+    {
+        return split_text(text, pattern);
+    }
+    else
+    {
+        auto chunks = split_text_chunks(policy, text, pattern);
+        return chunks.size() == 1 ? std::move(chunks.front()) : ParallelSplitDetails::concatenate(chunks);
+    }
+}
+
+#endif
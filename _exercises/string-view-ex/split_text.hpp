@@ -0,0 +1,335 @@
+#ifndef SPLIT_TEXT_HPP
+#define SPLIT_TEXT_HPP
+
+#include "token_range.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define SPLIT_TEXT_HAS_SIMD_KERNELS 1
+#endif
+
+// split_text(text, pattern) - tokens separated by runs of any character from pattern:
+//   split_text("one, two,three") -> {"one", "two", "three"}
+//   leading/trailing delimiters give an empty first/last token: split_text(", a, ") -> {"", "a", ""}
+// Cpp20::split_text(text, pattern) - std::views::split on the whole pattern (every occurrence separates tokens)
+// both collect the lazy ranges from token_range.hpp - use split_any_of/split_on directly to avoid the vector
+// Simd::split_text(text, pattern) - the same tokens as split_text, delimiters found 64 bytes at a time (AVX2/SSE4.2/scalar)
+//
+// no allocation per call in a per-line loop:
+//   split_text_into(tokens, line, pattern) - tokens (std::vector or std::pmr::vector) is cleared and refilled - its capacity is reused
+//   split_text(line, pattern, &arena)      - std::pmr::vector from a memory resource, e.g. a monotonic_buffer_resource released per batch
+
+template <typename Tokens>
+Tokens& split_text_into(Tokens& tokens, std::string_view text, std::string_view pattern = ", ")
+{
+    tokens.clear();
+
+    for (std::string_view token : split_any_of(text, pattern))
+        tokens.push_back(token);
+
+    return tokens;
+}
+
+inline std::vector<std::string_view> split_text(std::string_view text, std::string_view pattern = ", ")
+{
+    std::vector<std::string_view> result{};
+    split_text_into(result, text, pattern);
+    return result;
+}
+
+inline std::pmr::vector<std::string_view> split_text(std::string_view text, std::string_view pattern, std::pmr::memory_resource* resource)
+{
+    std::pmr::vector<std::string_view> result{resource};
+    split_text_into(result, text, pattern);
+    return result;
+}
+
+namespace Cpp20
+{
+    inline std::vector<std::string_view> split_text(std::string_view text, std::string_view pattern = " ")
+    {
+        std::vector<std::string_view> result{};
+
+        for (std::string_view token : split_on(text, pattern))
+            result.push_back(token);
+
+        return result;
+    }
+}
+
+namespace Simd
+{
+    enum class Kernel
+    {
+        scalar,
+        sse42,
+        avx2
+    };
+
+    namespace Details
+    {
+        inline constexpr size_t block_size = 64;
+        inline constexpr size_t max_vector_pattern = 16; // longer patterns use the scalar kernel
+
+        // turns delimiter bitmasks (bit i == 1 - text[base + i] is a delimiter) into tokens
+        template <typename Tokens>
+        class Tokenizer
+        {
+            std::string_view text_;
+            Tokens& result_;
+            size_t token_start_ = 0;
+            bool in_delimiter_ = false;
+
+        public:
+            Tokenizer(std::string_view text, Tokens& result)
+                : text_{text}
+                , result_{result}
+            {
+            }
+
+            // valid_bits - number of bytes of the block inside the text (< 64 only for the last block)
+            void consume(uint64_t mask, size_t base, size_t valid_bits = block_size)
+            {
+                const uint64_t valid = valid_bits == block_size ? ~uint64_t{0} : (uint64_t{1} << valid_bits) - 1;
+                uint64_t transitions = (mask ^ ((mask << 1) | uint64_t{in_delimiter_})) & valid;
+
+                // transitions alternate: delimiter run starts (token ends), delimiter run ends (token starts)
+                while (transitions != 0)
+                {
+                    const size_t pos = base + std::countr_zero(transitions);
+
+                    if (in_delimiter_)
+                        token_start_ = pos;
+                    else
+                        result_.push_back(text_.substr(token_start_, pos - token_start_));
+
+                    in_delimiter_ = !in_delimiter_;
+                    transitions &= transitions - 1;
+                }
+            }
+
+            void finish()
+            {
+                result_.push_back(in_delimiter_ ? text_.substr(text_.size()) : text_.substr(token_start_));
+            }
+        };
+
+        using DelimiterTable = std::array<bool, 256>;
+
+        inline DelimiterTable make_table(std::string_view pattern)
+        {
+            DelimiterTable table{};
+            for (char c : pattern)
+                table[static_cast<unsigned char>(c)] = true;
+            return table;
+        }
+
+        inline uint64_t delimiter_mask(const DelimiterTable& table, const char* data, size_t size)
+        {
+            uint64_t mask = 0;
+            for (size_t i = 0; i < size; ++i)
+                mask |= uint64_t{table[static_cast<unsigned char>(data[i])]} << i;
+            return mask;
+        }
+
+        template <typename Tokens>
+        void split_scalar(std::string_view text, std::string_view pattern, Tokens& result)
+        {
+            const auto table = make_table(pattern);
+            Tokenizer tokenizer{text, result};
+
+            for (size_t base = 0; base < text.size(); base += block_size)
+            {
+                const size_t size = std::min(block_size, text.size() - base);
+                tokenizer.consume(delimiter_mask(table, text.data() + base, size), base, size);
+            }
+
+            tokenizer.finish();
+        }
+
+#ifdef SPLIT_TEXT_HAS_SIMD_KERNELS
+        inline bool has_avx2()
+        {
+            static const bool supported = __builtin_cpu_supports("avx2");
+            return supported;
+        }
+
+        inline bool has_sse42()
+        {
+            static const bool supported = __builtin_cpu_supports("sse4.2");
+            return supported;
+        }
+
+        // 64 bytes vs. needle_count broadcast delimiters
+        __attribute__((target("avx2"))) inline uint64_t delimiter_mask_avx2(const char* data, const __m256i* needles, size_t needle_count)
+        {
+            const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+
+            __m256i low_matches = _mm256_setzero_si256();
+            __m256i high_matches = _mm256_setzero_si256();
+            for (size_t i = 0; i < needle_count; ++i)
+            {
+                low_matches = _mm256_or_si256(low_matches, _mm256_cmpeq_epi8(low, needles[i]));
+                high_matches = _mm256_or_si256(high_matches, _mm256_cmpeq_epi8(high, needles[i]));
+            }
+
+            return static_cast<uint32_t>(_mm256_movemask_epi8(low_matches))
+                 | (uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(high_matches))} << 32);
+        }
+
+        // pattern.size() <= max_vector_pattern
+        template <typename Tokens>
+        __attribute__((target("avx2"))) void split_avx2(std::string_view text, std::string_view pattern, Tokens& result)
+        {
+            __m256i needles[max_vector_pattern];
+            for (size_t i = 0; i < pattern.size(); ++i)
+                needles[i] = _mm256_set1_epi8(pattern[i]);
+
+            Tokenizer tokenizer{text, result};
+
+            size_t base = 0;
+            for (; base + block_size <= text.size(); base += block_size)
+                tokenizer.consume(delimiter_mask_avx2(text.data() + base, needles, pattern.size()), base);
+
+            if (base < text.size())
+            {
+                const size_t size = text.size() - base;
+                tokenizer.consume(delimiter_mask(make_table(pattern), text.data() + base, size), base, size);
+            }
+
+            tokenizer.finish();
+        }
+
+        // 64 bytes vs. up to 16 delimiters - PCMPESTRM "equal any" gives the mask of 16 bytes at once
+        __attribute__((target("sse4.2"))) inline uint64_t delimiter_mask_sse42(const char* data, __m128i needles, int needle_count)
+        {
+            uint64_t mask = 0;
+            for (int offset = 0; offset < 64; offset += 16)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+                const __m128i matches = _mm_cmpestrm(needles, needle_count, block, 16,
+                                                     _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_BIT_MASK);
+                mask |= uint64_t{static_cast<uint16_t>(_mm_cvtsi128_si32(matches))} << offset;
+            }
+            return mask;
+        }
+
+        // pattern.size() <= max_vector_pattern
+        template <typename Tokens>
+        __attribute__((target("sse4.2"))) void split_sse42(std::string_view text, std::string_view pattern, Tokens& result)
+        {
+            char needle_bytes[16]{};
+            std::copy(pattern.begin(), pattern.end(), needle_bytes);
+            const __m128i needles = _mm_loadu_si128(reinterpret_cast<const __m128i*>(needle_bytes));
+            const int needle_count = static_cast<int>(pattern.size());
+
+            Tokenizer tokenizer{text, result};
+
+            size_t base = 0;
+            for (; base + block_size <= text.size(); base += block_size)
+                tokenizer.consume(delimiter_mask_sse42(text.data() + base, needles, needle_count), base);
+
+            if (base < text.size())
+            {
+                const size_t size = text.size() - base;
+                tokenizer.consume(delimiter_mask(make_table(pattern), text.data() + base, size), base, size);
+            }
+
+            tokenizer.finish();
+        }
+#endif
+    }
+
+    inline bool is_supported(Kernel kernel)
+    {
+#ifdef SPLIT_TEXT_HAS_SIMD_KERNELS
+        if (kernel == Kernel::avx2)
+            return Details::has_avx2();
+        if (kernel == Kernel::sse42)
+            return Details::has_sse42();
+#endif
+        return kernel == Kernel::scalar;
+    }
+
+    // the fastest kernel supported by the CPU
+    inline Kernel best_kernel()
+    {
+        if (is_supported(Kernel::avx2))
+            return Kernel::avx2;
+        if (is_supported(Kernel::sse42))
+            return Kernel::sse42;
+        return Kernel::scalar;
+    }
+
+    // kernel must be supported - see is_supported()
+    template <typename Tokens>
+    Tokens& split_text_into(Tokens& tokens, std::string_view text, std::string_view pattern, Kernel kernel)
+    {
+        tokens.clear();
+
+        if (pattern.empty())
+        {
+            tokens.push_back(text);
+            return tokens;
+        }
+
+#ifdef SPLIT_TEXT_HAS_SIMD_KERNELS
+        if (pattern.size() <= Details::max_vector_pattern)
+        {
+            if (kernel == Kernel::avx2)
+            {
+                Details::split_avx2(text, pattern, tokens);
+                return tokens;
+            }
+            if (kernel == Kernel::sse42)
+            {
+                Details::split_sse42(text, pattern, tokens);
+                return tokens;
+            }
+        }
+#endif
+
+        Details::split_scalar(text, pattern, tokens);
+        return tokens;
+    }
+
+    template <typename Tokens>
+    Tokens& split_text_into(Tokens& tokens, std::string_view text, std::string_view pattern = ", ")
+    {
+        static const Kernel kernel = best_kernel();
+        return split_text_into(tokens, text, pattern, kernel);
+    }
+
+    inline std::vector<std::string_view> split_text(std::string_view text, std::string_view pattern, Kernel kernel)
+    {
+        std::vector<std::string_view> result{};
+        split_text_into(result, text, pattern, kernel);
+        return result;
+    }
+
+    inline std::vector<std::string_view> split_text(std::string_view text, std::string_view pattern = ", ")
+    {
+        std::vector<std::string_view> result{};
+        split_text_into(result, text, pattern);
+        return result;
+    }
+
+    inline std::pmr::vector<std::string_view> split_text(std::string_view text, std::string_view pattern, std::pmr::memory_resource* resource)
+    {
+        std::pmr::vector<std::string_view> result{resource};
+        split_text_into(result, text, pattern);
+        return result;
+    }
+}
+
+#endif
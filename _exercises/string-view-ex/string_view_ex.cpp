@@ -1,6 +1,14 @@
+#include "split_text.hpp"
+
+#include <buffered_writer.hpp>
+
 #include <algorithm>
+#include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <cstddef>
 #include <iostream>
+#include <memory_resource>
+#include <random>
 #include <ranges>
 #include <set>
 #include <string>
@@ -12,70 +20,181 @@ using namespace std;
 template <typename Container>
 void print_all(const Container& container, std::string_view prefix)
 {
-    cout << prefix << ": [ ";
+    BufferedWriter out;
+    out << prefix << ": [ ";
     for (const auto& item : container)
-        cout << item << " ";
-    cout << "]\n";
+        out << item << " ";
+    out << "]\n";
 }
 
-std::vector<std::string_view> split_text(std::string_view text, std::string_view pattern = ", ")
+TEST_CASE("split with spaces")
 {
-    std::vector<std::string_view> result{};
+    const char* text = "one two three four";
 
-    size_t start{};
-    size_t end{};
+    std::vector<std::string_view> words = Cpp20::split_text(text);
 
-    while (end != std::string_view::npos)
-    {
-        end = text.find_first_of(pattern, start);
-        std::string_view token = text.substr(start, end - start);
-        result.push_back(token);
-        start = text.find_first_not_of(pattern, end);
-    }
+    print_all(words, "words");
+
+    auto expected = {"one", "two", "three", "four"};
 
-    return result;
+    REQUIRE(equal(begin(expected), end(expected), begin(words)));
 }
 
-namespace Cpp20
+TEST_CASE("split with commas")
 {
-    std::vector<std::string_view> split_text(std::string_view text, std::string_view pattern = " ")
-    {
-        std::vector<std::string_view> result{};
+    string text = "one,two,three,four";
 
-        auto tokens = std::views::split(text, pattern);
+    auto words = Cpp20::split_text(text, ",");
+
+    print_all(words, "words");
 
-        for (auto&& token : tokens)
+    auto expected = {"one", "two", "three", "four"};
+
+    REQUIRE(equal(begin(expected), end(expected), begin(words)));
+}
+
+TEST_CASE("split_text - runs of delimiters")
+{
+    REQUIRE(split_text("one, two,three") == vector<string_view>{"one", "two", "three"});
+    REQUIRE(split_text(", one, ") == vector<string_view>{"", "one", ""});
+    REQUIRE(split_text("") == vector<string_view>{""});
+    REQUIRE(split_text("one", "") == vector<string_view>{"one"});
+}
+
+TEST_CASE("Simd::split_text")
+{
+    const vector<Simd::Kernel> kernels = {Simd::Kernel::scalar, Simd::Kernel::sse42, Simd::Kernel::avx2};
+
+    auto require_same_tokens = [&](string_view text, string_view pattern) {
+        const auto expected = split_text(text, pattern);
+
+        for (auto kernel : kernels)
         {
-            std::string_view token_sv{token.begin(), token.size()};
-            result.push_back(token_sv);
+            if (Simd::is_supported(kernel))
+                REQUIRE(Simd::split_text(text, pattern, kernel) == expected);
         }
 
-        return result;
+        REQUIRE(Simd::split_text(text, pattern) == expected);
+    };
+
+    SECTION("short texts")
+    {
+        for (string_view text : {"", ",", ", ,", "one", "one, two,three", ", one, two, ", "a,b,,c, "})
+            require_same_tokens(text, ", ");
+
+        require_same_tokens("one two", "");
+    }
+
+    SECTION("delimiter runs crossing 64-byte blocks")
+    {
+        string text = string(63, 'x') + ",," + string(62, 'y') + string(70, ',') + "z";
+        require_same_tokens(text, ",");
+    }
+
+    SECTION("random texts")
+    {
+        mt19937_64 rnd_gen(665);
+        const string alphabet = "ab ,;\t\n\0\xff"s;
+        uniform_int_distribution<size_t> letter_distribution(0, alphabet.size() - 1);
+        uniform_int_distribution<size_t> length_distribution(0, 500);
+
+        for (int i = 0; i < 200; ++i)
+        {
+            string text(length_distribution(rnd_gen), ' ');
+            generate(text.begin(), text.end(), [&] { return alphabet[letter_distribution(rnd_gen)]; });
+
+            require_same_tokens(text, ", ");
+            require_same_tokens(text, " ,;\t\n");
+            require_same_tokens(text, "\0\xff"s);
+            require_same_tokens(text, "abcdefghijklmnopqrstuvwxyz ,;"); // longer than 16 characters - scalar kernel
+        }
     }
 }
 
-TEST_CASE("split with spaces")
+TEST_CASE("split_text - reused buffers & memory resources")
 {
-    const char* text = "one two three four";
+    const vector<string_view> lines = {"one, two,three", "a,b,,c, ", "", "single"};
 
-    std::vector<std::string_view> words = Cpp20::split_text(text);
+    SECTION("split_text_into reuses the capacity")
+    {
+        vector<string_view> tokens;
+        tokens.reserve(16);
+        const auto* buffer = tokens.data();
 
-    print_all(words, "words");
+        for (auto line : lines)
+        {
+            REQUIRE(split_text_into(tokens, line) == split_text(line));
+            REQUIRE(Simd::split_text_into(tokens, line) == split_text(line));
+            REQUIRE(tokens.data() == buffer);
+        }
+    }
 
-    auto expected = {"one", "two", "three", "four"};
+    SECTION("pmr vectors allocated only from the arena")
+    {
+        std::array<std::byte, 4096> buffer;
+        std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
 
-    REQUIRE(equal(begin(expected), end(expected), begin(words)));
+        for (int batch = 0; batch < 100; ++batch)
+        {
+            for (auto line : lines)
+            {
+                const auto expected = split_text(line);
+                REQUIRE(std::ranges::equal(split_text(line, ", ", &arena), expected));
+                REQUIRE(std::ranges::equal(Simd::split_text(line, ", ", &arena), expected));
+            }
+
+            arena.release(); // would throw bad_alloc above if the arena had to ask upstream
+        }
+    }
 }
 
-TEST_CASE("split with commas")
+TEST_CASE("lazy token ranges")
 {
-    string text = "one,two,three,four";
+    static_assert(std::ranges::forward_range<SplitAnyOfView> && std::ranges::common_range<SplitAnyOfView> && std::ranges::view<SplitAnyOfView>);
+    static_assert(std::ranges::forward_range<SplitOnView> && std::ranges::common_range<SplitOnView> && std::ranges::view<SplitOnView>);
 
-    auto words = Cpp20::split_text(text, ",");
+    SECTION("split_any_of - tokens on demand")
+    {
+        vector<string_view> words;
+        for (string_view token : split_any_of("one, two,,three", ", "))
+            words.push_back(token);
 
-    print_all(words, "words");
+        REQUIRE(words == vector<string_view>{"one", "two", "three"});
+    }
 
-    auto expected = {"one", "two", "three", "four"};
+    SECTION("early exit & composition with views")
+    {
+        auto long_words = split_any_of("a bb ccc dddd eeeee ffffff", " ")
+                        | std::views::filter([](string_view w) { return w.size() > 2; })
+                        | std::views::take(2);
+
+        vector<string_view> words;
+        for (string_view word : long_words)
+            words.push_back(word);
+        REQUIRE(words == vector<string_view>{"ccc", "dddd"});
+
+        auto first = split_on("key=value=rest", "=");
+        REQUIRE(first.front() == "key");
+        REQUIRE(std::ranges::distance(first) == 3);
+    }
 
-    REQUIRE(equal(begin(expected), end(expected), begin(words)));
+    SECTION("split_on has std::views::split semantics")
+    {
+        auto to_vector = [](auto&& range) {
+            vector<string_view> tokens;
+            for (auto&& token : range)
+                tokens.push_back(string_view(token.begin(), token.end()));
+            return tokens;
+        };
+
+        for (string_view text : {"", " ", "a", "a b", " a  b ", "ab--cd--", "--"})
+        {
+            for (string_view pattern : {" ", "--", "", "x"})
+            {
+                const auto expected = to_vector(std::views::split(text, pattern));
+                REQUIRE(Cpp20::split_text(text, pattern) == expected);
+                REQUIRE(to_vector(split_on(text, pattern)) == expected);
+            }
+        }
+    }
 }
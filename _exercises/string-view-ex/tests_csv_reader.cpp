@@ -0,0 +1,111 @@
+#include "csv_reader.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    vector<vector<string>> read_all(string_view text, CsvDialect dialect = {})
+    {
+        vector<vector<string>> rows;
+        CsvReader reader{text, dialect};
+        for (const auto& fields : reader)
+            rows.emplace_back(fields.begin(), fields.end());
+        return rows;
+    }
+}
+
+TEST_CASE("CsvReader")
+{
+    SECTION("unquoted fields are views into the text")
+    {
+        const string_view text = "id,name,price\n1,Jan,2.5\n";
+        CsvReader reader{text};
+
+        REQUIRE(reader.read_row());
+        REQUIRE(reader.fields() == vector<string_view>{"id", "name", "price"});
+        REQUIRE(reader.read_row());
+        REQUIRE(reader.fields()[1].data() == text.data() + text.find("Jan"));
+        REQUIRE_FALSE(reader.read_row());
+        REQUIRE(reader.row_count() == 2);
+    }
+
+    SECTION("empty fields, \\r\\n line ends and blank lines")
+    {
+        REQUIRE(read_all("a,,c\r\n\r\n\n,b,\n,") == vector<vector<string>>{{"a", "", "c"}, {"", "b", ""}, {"", ""}});
+    }
+
+    SECTION("quoted fields")
+    {
+        const string_view text = "1,\"Doe, John\",\"say \"\"hi\"\"\"\n"
+                                 "2,\"multi\nline\",\"\"\n"
+                                 "3,x\"y,z";
+
+        REQUIRE(read_all(text) == vector<vector<string>>{{"1", "Doe, John", "say \"hi\""}, {"2", "multi\nline", ""}, {"3", "x\"y", "z"}});
+    }
+
+    SECTION("quoted field without doubled quotes is not copied")
+    {
+        const string_view text = "\"Doe, John\"";
+        CsvReader reader{text};
+
+        REQUIRE(reader.read_row());
+        REQUIRE(reader.fields()[0].data() == text.data() + 1);
+    }
+
+    SECTION("header & line numbers")
+    {
+        CsvReader reader{"id;name\n1;\"a\nb\"\n\n2;c\n", {.delimiter = ';', .header = true}};
+
+        REQUIRE(reader.read_row());
+        REQUIRE(reader.line() == 2);
+        REQUIRE(reader.read_row());
+        REQUIRE(reader.line() == 5);
+        REQUIRE(reader.fields() == vector<string_view>{"2", "c"});
+        REQUIRE(reader.row_count() == 2);
+    }
+
+    SECTION("malformed quoting")
+    {
+        REQUIRE_THROWS_AS(read_all("1,\"open\n2,3\n"), runtime_error);
+        REQUIRE_THROWS_AS(read_all("1,\"closed\"x,3\n"), runtime_error);
+    }
+}
+
+TEST_CASE("read_columns")
+{
+    const string_view text = "id,price,stock,comment\n"
+                             "1,2.5,10,ok\n"
+                             "2,0.75,,\"no stock\"\n"
+                             "3,100,n/a\n";
+
+    SECTION("typed columns")
+    {
+        const auto [ids, prices, stock] = read_columns<int, double, optional<int>>(text, {.header = true});
+
+        REQUIRE(ids == vector{1, 2, 3});
+        REQUIRE(prices.size() == 3);
+        REQUIRE(prices[1] == Catch::Approx(0.75));
+        REQUIRE(stock == vector<optional<int>>{10, nullopt, nullopt});
+    }
+
+    SECTION("missing optional column")
+    {
+        const auto [ids, comments] = read_columns<int, optional<int>>("1\n2,3\n");
+
+        REQUIRE(comments == vector<optional<int>>{nullopt, 3});
+    }
+
+    SECTION("invalid value")
+    {
+        REQUIRE_THROWS_AS((read_columns<int, int>(text, {.header = true})), invalid_argument);
+        REQUIRE_THROWS_AS((read_columns<int>(text)), invalid_argument); // header read as data
+    }
+}
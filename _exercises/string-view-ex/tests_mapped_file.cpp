@@ -0,0 +1,86 @@
+#include "mapped_file.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    struct TemporaryFile
+    {
+        filesystem::path path;
+
+        TemporaryFile(const string& name, string_view content)
+            : path{filesystem::temp_directory_path() / name}
+        {
+            ofstream out(path, ios::binary);
+            out << content;
+        }
+
+        ~TemporaryFile()
+        {
+            filesystem::remove(path);
+        }
+    };
+}
+
+TEST_CASE("MappedFile")
+{
+    SECTION("content as string_view")
+    {
+        TemporaryFile file{"mapped_file_content.txt", "one two\nthree\n"};
+        MappedFile mapped{file.path.string()};
+
+        REQUIRE(mapped.size() == 14);
+        REQUIRE(mapped.view() == "one two\nthree\n");
+    }
+
+    SECTION("lines & fields")
+    {
+        TemporaryFile file{"mapped_file_lines.txt", "id,name\r\n1, Jan\n\n2,Ewa\n"};
+        MappedFile mapped{file.path.string()};
+
+        vector<string_view> lines;
+        for (string_view line : mapped.lines())
+            lines.push_back(line);
+        REQUIRE(lines == vector<string_view>{"id,name", "1, Jan", "2,Ewa"});
+
+        vector<vector<string_view>> records;
+        for (auto fields : mapped.records(", "))
+            records.emplace_back(fields.begin(), fields.end());
+        REQUIRE(records == vector<vector<string_view>>{{"id", "name"}, {"1", "Jan"}, {"2", "Ewa"}});
+    }
+
+    SECTION("tokens stay valid after the mapping is moved")
+    {
+        TemporaryFile file{"mapped_file_move.txt", "alpha beta"};
+        MappedFile mapped{file.path.string(), MappedFile::Advice::random};
+        const string_view first = *split_any_of(mapped.view(), " ").begin();
+
+        MappedFile other = std::move(mapped);
+        REQUIRE(first == "alpha");
+        REQUIRE(first.data() == other.data());
+        REQUIRE(mapped.empty());
+    }
+
+    SECTION("empty file")
+    {
+        TemporaryFile file{"mapped_file_empty.txt", ""};
+        MappedFile mapped{file.path.string()};
+
+        REQUIRE(mapped.empty());
+        REQUIRE(mapped.view().empty());
+        REQUIRE(std::ranges::distance(mapped.lines()) == 0);
+    }
+
+    SECTION("missing file")
+    {
+        REQUIRE_THROWS_AS(MappedFile{"/nonexistent/file.txt"}, std::system_error);
+    }
+}
@@ -0,0 +1,68 @@
+#include "parallel_split.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <execution>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    string random_text(size_t size, string_view alphabet, uint64_t seed)
+    {
+        mt19937_64 rnd_gen(seed);
+        uniform_int_distribution<size_t> letter_distribution(0, alphabet.size() - 1);
+
+        string text(size, ' ');
+        generate(text.begin(), text.end(), [&] { return alphabet[letter_distribution(rnd_gen)]; });
+        return text;
+    }
+}
+
+TEST_CASE("parallel split_text")
+{
+    SECTION("the same tokens as split_text for every chunk size")
+    {
+        for (string_view alphabet : {"ab, ", "abcdefgh ", ",,,a", "abcdefghijklmnopqrstuvwxyz"})
+        {
+            const auto text = random_text(5'000, alphabet, alphabet.size());
+            const auto expected = split_text(text, ", ");
+
+            for (size_t chunk_size : {1, 2, 3, 7, 64, 1000, 4999, 5000, 10000})
+            {
+                const auto chunks = ParallelSplitDetails::split_chunks(text, ", ", chunk_size);
+                REQUIRE(ParallelSplitDetails::concatenate(chunks) == expected);
+            }
+        }
+    }
+
+    SECTION("leading & trailing delimiters")
+    {
+        const string text = ", one, two,three, ";
+        for (size_t chunk_size : {1, 2, 5})
+            REQUIRE(ParallelSplitDetails::concatenate(ParallelSplitDetails::split_chunks(text, ", ", chunk_size)) == split_text(text));
+    }
+
+    SECTION("execution policies")
+    {
+        const auto text = random_text(3'000'000, "abcdefg \n", 665);
+        const auto expected = split_text(text, " \n");
+
+        REQUIRE(split_text(execution::seq, text, " \n") == expected);
+        REQUIRE(split_text(execution::par, text, " \n") == expected);
+
+        const auto chunks = split_text_chunks(execution::par, text, " \n");
+        REQUIRE(chunks.size() > 1);
+        REQUIRE(ParallelSplitDetails::concatenate(chunks) == expected);
+    }
+
+    SECTION("empty text & pattern")
+    {
+        REQUIRE(split_text(execution::par, "", ", ") == vector<string_view>{""});
+        REQUIRE(split_text(execution::par, "a, b", "") == vector<string_view>{"a, b"});
+    }
+}
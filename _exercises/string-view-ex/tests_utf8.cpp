@@ -0,0 +1,108 @@
+#include "utf8.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("Utf8::find_invalid")
+{
+    SECTION("valid texts")
+    {
+        for (string_view text : {"", "ascii only", "zażółć gęślą jaźń", "€ 100 — ok", "\U0001F600 emoji", "\U0010FFFF"})
+        {
+            REQUIRE(Utf8::is_valid(text));
+            REQUIRE(Utf8::find_invalid(text) == string_view::npos);
+        }
+    }
+
+    SECTION("ill-formed sequences")
+    {
+        REQUIRE(Utf8::find_invalid("abc\x80") == 3);         // lone continuation byte
+        REQUIRE(Utf8::find_invalid("\xC0\xAF") == 0);        // overlong '/'
+        REQUIRE(Utf8::find_invalid("\xE0\x80\xAF") == 0);    // overlong 3-byte
+        REQUIRE(Utf8::find_invalid("a\xED\xA0\x80") == 1);   // surrogate U+D800
+        REQUIRE(Utf8::find_invalid("\xF4\x90\x80\x80") == 0); // > U+10FFFF
+        REQUIRE(Utf8::find_invalid("ok \xC5") == 3);         // truncated
+        REQUIRE(Utf8::find_invalid("\xFF") == 0);
+    }
+
+    SECTION("errors after long ASCII runs and across 64-byte blocks")
+    {
+        for (size_t prefix : {0, 31, 63, 64, 65, 127, 200})
+        {
+            const string text = string(prefix, 'a') + "ł" + string(100, 'b') + "\xC5" + "x";
+            REQUIRE(Utf8::find_invalid(text) == prefix + 2 + 100);
+        }
+    }
+
+    SECTION("the same result as the byte-by-byte reference")
+    {
+        mt19937_64 rnd_gen(665);
+        const vector<string> pieces = {"a", "bcd ", "ż", "€", "\U0001F600", "\x80", "\xC5", "\xED\xA0\x80", string(70, 'x')};
+        uniform_int_distribution<size_t> piece_distribution(0, pieces.size() - 1);
+
+        for (int i = 0; i < 500; ++i)
+        {
+            string text;
+            for (int count = i % 40; count > 0; --count)
+                text += pieces[piece_distribution(rnd_gen)];
+
+            REQUIRE(Utf8::find_invalid(text) == Utf8::Details::find_invalid_scalar(text));
+        }
+    }
+}
+
+TEST_CASE("Utf8::split_text")
+{
+    SECTION("multi-byte delimiters")
+    {
+        REQUIRE(Utf8::split_text("one—two · three", " —·") == vector<string_view>{"one", "two", "three"});
+        REQUIRE(Utf8::split_text("żółw,źrebię", ",") == vector<string_view>{"żółw", "źrebię"});
+    }
+
+    SECTION("a delimiter never matches part of a code point")
+    {
+        // "ł" is C5 82, "ń" is C5 84 - a byte-based split on "ł" would cut "ń"
+        REQUIRE(Utf8::split_text("koń", "ł") == vector<string_view>{"koń"});
+        REQUIRE(split_text("koń", "ł") != vector<string_view>{"koń"});
+    }
+
+    SECTION("ill-formed text - nullopt")
+    {
+        REQUIRE(Utf8::split_text("one, t\xC5o") == nullopt);
+        REQUIRE(Utf8::split_text(string(100, 'a') + "\xFF") == nullopt);
+        REQUIRE_THROWS_AS(Utf8::split_text("text", "\xC5"), invalid_argument);
+    }
+
+    SECTION("delimiters crossing 64-byte blocks")
+    {
+        for (size_t prefix : {60, 61, 62, 63, 64, 127})
+        {
+            const string text = string(prefix, 'a') + "—" + string(100, 'b') + " — " + "ć";
+            const vector<string_view> expected{string_view(text).substr(0, prefix), string_view(text).substr(prefix + 3, 100), "ć"};
+
+            REQUIRE(Utf8::split_text(text, " —") == expected);
+        }
+    }
+
+    SECTION("ASCII delimiters - the same tokens as split_text")
+    {
+        mt19937_64 rnd_gen(42);
+        const vector<string> pieces = {"a", "bc", " ", ",", "ż", "€", "\U0001F600", string(70, 'x')};
+        uniform_int_distribution<size_t> piece_distribution(0, pieces.size() - 1);
+
+        for (int i = 0; i < 300; ++i)
+        {
+            string text;
+            for (int count = i % 60; count > 0; --count)
+                text += pieces[piece_distribution(rnd_gen)];
+
+            REQUIRE(Utf8::split_text(text, ", ") == split_text(text, ", "));
+        }
+    }
+}
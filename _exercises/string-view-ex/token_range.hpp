@@ -0,0 +1,239 @@
+#ifndef TOKEN_RANGE_HPP
+#define TOKEN_RANGE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+
+// Lazy token ranges - tokens are std::string_view into the text, found on demand, no heap allocation:
+//   split_any_of(text, ", ") - tokens separated by runs of any character from the pattern (split_text semantics)
+//   split_on(text, " ")      - tokens separated by every occurrence of the whole pattern (std::views::split semantics)
+//
+//   for (std::string_view token : split_any_of(line, " \t"))
+//       ...
+//   auto first_three = split_any_of(line, ",") | std::views::take(3);
+// Iterators refer to the range object - it must outlive them (like std::ranges::split_view).
+
+class SplitAnyOfView : public std::ranges::view_interface<SplitAnyOfView>
+{
+    std::string_view text_;
+    std::array<bool, 256> is_delimiter_{};
+
+public:
+    class iterator
+    {
+        const SplitAnyOfView* view_ = nullptr;
+        size_t start_ = std::string_view::npos; // npos - past the last token
+        size_t end_ = std::string_view::npos;
+
+    public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+        iterator() = default;
+
+        iterator(const SplitAnyOfView& view, size_t start)
+            : view_{&view}
+            , start_{start}
+            , end_{view.find_delimiter(start)}
+        {
+        }
+
+        std::string_view operator*() const
+        {
+            return view_->text_.substr(start_, end_ - start_);
+        }
+
+        iterator& operator++()
+        {
+            if (end_ == view_->text_.size()) // the last token - no delimiter after it
+            {
+                start_ = end_ = std::string_view::npos;
+            }
+            else
+            {
+                start_ = view_->find_token(end_);
+                end_ = view_->find_delimiter(start_);
+            }
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        friend bool operator==(const iterator& a, const iterator& b)
+        {
+            return a.start_ == b.start_;
+        }
+    };
+
+    SplitAnyOfView() = default;
+
+    SplitAnyOfView(std::string_view text, std::string_view pattern)
+        : text_{text}
+    {
+        for (char c : pattern)
+            is_delimiter_[static_cast<unsigned char>(c)] = true;
+    }
+
+    iterator begin() const
+    {
+        return iterator{*this, 0};
+    }
+
+    iterator end() const
+    {
+        return iterator{};
+    }
+
+private:
+    bool is_delimiter(char c) const
+    {
+        return is_delimiter_[static_cast<unsigned char>(c)];
+    }
+
+    // position of the first delimiter at or after pos - text_.size() if none
+    size_t find_delimiter(size_t pos) const
+    {
+        return std::find_if(text_.begin() + pos, text_.end(), [this](char c) { return is_delimiter(c); }) - text_.begin();
+    }
+
+    // position of the first non-delimiter at or after pos - text_.size() if none
+    size_t find_token(size_t pos) const
+    {
+        return std::find_if_not(text_.begin() + pos, text_.end(), [this](char c) { return is_delimiter(c); }) - text_.begin();
+    }
+};
+
+class SplitOnView : public std::ranges::view_interface<SplitOnView>
+{
+    std::string_view text_;
+    std::string_view pattern_;
+
+public:
+    class iterator
+    {
+        const SplitOnView* view_ = nullptr;
+        size_t current_ = 0;     // start of the token
+        size_t match_begin_ = 0; // end of the token
+        size_t match_end_ = 0;
+        bool trailing_empty_ = false; // the text ends with the pattern - one more empty token
+
+    public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+        iterator() = default;
+
+        explicit iterator(const SplitOnView& view)
+            : view_{&view}
+        {
+            find_next(0);
+        }
+
+        std::string_view operator*() const
+        {
+            return view_->text_.substr(current_, match_begin_ - current_);
+        }
+
+        iterator& operator++()
+        {
+            const size_t size = view_->text_.size();
+
+            if (match_begin_ == size)
+            {
+                current_ = size;
+                trailing_empty_ = false;
+            }
+            else if (match_end_ == size)
+            {
+                current_ = match_begin_ = size;
+                trailing_empty_ = true;
+            }
+            else
+            {
+                current_ = match_end_;
+                find_next(current_);
+            }
+
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        friend bool operator==(const iterator& a, const iterator& b)
+        {
+            return a.current_ == b.current_ && a.trailing_empty_ == b.trailing_empty_;
+        }
+
+    private:
+        friend class SplitOnView;
+
+        // past the last token
+        iterator(const SplitOnView& view, size_t size)
+            : view_{&view}
+            , current_{size}
+            , match_begin_{size}
+            , match_end_{size}
+        {
+        }
+
+        void find_next(size_t pos)
+        {
+            const std::string_view text = view_->text_;
+            const std::string_view pattern = view_->pattern_;
+
+            match_begin_ = std::min(text.find(pattern, pos), text.size());
+            match_end_ = std::min(match_begin_ + pattern.size(), text.size());
+
+            if (pattern.empty() && match_begin_ != text.size()) // empty pattern - every character is a token
+                match_end_ = ++match_begin_;
+        }
+    };
+
+    SplitOnView() = default;
+
+    SplitOnView(std::string_view text, std::string_view pattern)
+        : text_{text}
+        , pattern_{pattern}
+    {
+    }
+
+    iterator begin() const
+    {
+        return iterator{*this};
+    }
+
+    iterator end() const
+    {
+        return iterator{*this, text_.size()};
+    }
+};
+
+inline SplitAnyOfView split_any_of(std::string_view text, std::string_view pattern = ", ")
+{
+    return SplitAnyOfView{text, pattern};
+}
+
+inline SplitOnView split_on(std::string_view text, std::string_view pattern = " ")
+{
+    return SplitOnView{text, pattern};
+}
+
+#endif
@@ -0,0 +1,321 @@
+#ifndef UTF8_HPP
+#define UTF8_HPP
+
+#include "split_text.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// UTF-8 aware text utilities - ASCII is skipped 64 bytes at a time (AVX2), only non-ASCII bytes are decoded:
+//   Utf8::is_valid(text) / Utf8::find_invalid(text) - well-formed UTF-8 (no overlongs, surrogates or code points > U+10FFFF)
+//   Utf8::split_text(text, pattern) - split_text semantics with code points as delimiters ("—", "·" or ASCII),
+//                                     validated in the same pass: nullopt for ill-formed text
+//
+//   if (auto tokens = Utf8::split_text(untrusted, " —"))
+//       for (std::string_view token : *tokens) // never cut in the middle of a code point
+//           ...
+
+namespace Utf8
+{
+    namespace Details
+    {
+        inline bool is_continuation(unsigned char c)
+        {
+            return (c & 0xC0) == 0x80;
+        }
+
+        // length of the well-formed sequence at text[pos] (Unicode table 3-7) - 0 if ill-formed or truncated
+        inline size_t sequence_length(std::string_view text, size_t pos)
+        {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(text.data()) + pos;
+            const size_t available = text.size() - pos;
+            const unsigned char lead = bytes[0];
+
+            if (lead < 0x80)
+                return 1;
+
+            if (lead < 0xC2) // continuation byte or overlong 2-byte lead
+                return 0;
+
+            if (lead < 0xE0)
+                return available >= 2 && is_continuation(bytes[1]) ? 2 : 0;
+
+            if (lead < 0xF0)
+            {
+                if (available < 3 || !is_continuation(bytes[2]))
+                    return 0;
+
+                const unsigned char second = bytes[1];
+                if (lead == 0xE0)
+                    return second >= 0xA0 && second <= 0xBF ? 3 : 0; // overlong
+                if (lead == 0xED)
+                    return second >= 0x80 && second <= 0x9F ? 3 : 0; // surrogates
+                return is_continuation(second) ? 3 : 0;
+            }
+
+            if (lead < 0xF5)
+            {
+                if (available < 4 || !is_continuation(bytes[2]) || !is_continuation(bytes[3]))
+                    return 0;
+
+                const unsigned char second = bytes[1];
+                if (lead == 0xF0)
+                    return second >= 0x90 && second <= 0xBF ? 4 : 0; // overlong
+                if (lead == 0xF4)
+                    return second >= 0x80 && second <= 0x8F ? 4 : 0; // > U+10FFFF
+                return is_continuation(second) ? 4 : 0;
+            }
+
+            return 0;
+        }
+
+        // the first non-ASCII byte at or after pos (text.size() if none) - 8 bytes at a time
+        inline size_t skip_ascii_swar(std::string_view text, size_t pos)
+        {
+            constexpr uint64_t high_bits = 0x8080808080808080;
+
+            for (; pos + 8 <= text.size(); pos += 8)
+            {
+                uint64_t word;
+                std::memcpy(&word, text.data() + pos, 8);
+                if (word & high_bits)
+                    break;
+            }
+
+            while (pos < text.size() && static_cast<unsigned char>(text[pos]) < 0x80)
+                ++pos;
+
+            return pos;
+        }
+
+#ifdef SPLIT_TEXT_HAS_SIMD_KERNELS
+        __attribute__((target("avx2"))) inline size_t skip_ascii_avx2(std::string_view text, size_t pos)
+        {
+            for (; pos + 64 <= text.size(); pos += 64)
+            {
+                const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + pos));
+                const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + pos + 32));
+                if (_mm256_movemask_epi8(_mm256_or_si256(low, high)) != 0)
+                    break;
+            }
+
+            return skip_ascii_swar(text, pos);
+        }
+#endif
+
+        inline size_t skip_ascii(std::string_view text, size_t pos)
+        {
+#ifdef SPLIT_TEXT_HAS_SIMD_KERNELS
+            if (Simd::Details::has_avx2())
+                return skip_ascii_avx2(text, pos);
+#endif
+            return skip_ascii_swar(text, pos);
+        }
+
+        // byte-by-byte reference - no ASCII fast path
+        inline size_t find_invalid_scalar(std::string_view text)
+        {
+            for (size_t pos = 0; pos < text.size();)
+            {
+                const size_t length = sequence_length(text, pos);
+                if (length == 0)
+                    return pos;
+                pos += length;
+            }
+            return std::string_view::npos;
+        }
+
+        // delimiters of a UTF-8 pattern - ASCII in a byte table, multi-byte code points as their sequences
+        struct Delimiters
+        {
+            Simd::Details::DelimiterTable ascii{};
+            std::vector<char> ascii_bytes; // distinct ASCII delimiters - needles of the vector kernel
+            std::vector<std::string_view> multibyte;
+
+            explicit Delimiters(std::string_view pattern)
+            {
+                for (size_t pos = 0; pos < pattern.size();)
+                {
+                    const size_t length = sequence_length(pattern, pos);
+                    if (length == 0)
+                        throw std::invalid_argument("Utf8::split_text: pattern is not valid UTF-8");
+
+                    if (length == 1)
+                    {
+                        if (!ascii[static_cast<unsigned char>(pattern[pos])])
+                            ascii_bytes.push_back(pattern[pos]);
+                        ascii[static_cast<unsigned char>(pattern[pos])] = true;
+                    }
+                    else
+                    {
+                        multibyte.push_back(pattern.substr(pos, length));
+                    }
+
+                    pos += length;
+                }
+            }
+
+            bool contains(std::string_view code_point) const
+            {
+                if (code_point.size() == 1)
+                    return ascii[static_cast<unsigned char>(code_point[0])];
+                return std::find(multibyte.begin(), multibyte.end(), code_point) != multibyte.end();
+            }
+        };
+
+        struct BlockMasks
+        {
+            uint64_t delimiters; // ASCII delimiters
+            uint64_t non_ascii;  // bytes >= 0x80 - code points to decode
+        };
+
+        inline BlockMasks block_masks_scalar(const char* data, size_t size, const Delimiters& delimiters)
+        {
+            BlockMasks masks{Simd::Details::delimiter_mask(delimiters.ascii, data, size), 0};
+            for (size_t i = 0; i < size; ++i)
+                masks.non_ascii |= uint64_t{static_cast<unsigned char>(data[i]) >= 0x80} << i;
+            return masks;
+        }
+
+        struct ScalarBlock
+        {
+            BlockMasks operator()(const char* data, const Delimiters& delimiters) const
+            {
+                return block_masks_scalar(data, Simd::Details::block_size, delimiters);
+            }
+        };
+
+#ifdef SPLIT_TEXT_HAS_SIMD_KERNELS
+        struct Avx2Block
+        {
+            __m256i needles[Simd::Details::max_vector_pattern];
+            size_t needle_count;
+
+            __attribute__((target("avx2"))) explicit Avx2Block(const Delimiters& delimiters)
+                : needle_count{delimiters.ascii_bytes.size()}
+            {
+                for (size_t i = 0; i < needle_count; ++i)
+                    needles[i] = _mm256_set1_epi8(delimiters.ascii_bytes[i]);
+            }
+
+            __attribute__((target("avx2"))) BlockMasks operator()(const char* data, const Delimiters&) const
+            {
+                const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+                const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+                const uint64_t non_ascii = static_cast<uint32_t>(_mm256_movemask_epi8(low))
+                                         | (uint64_t{static_cast<uint32_t>(_mm256_movemask_epi8(high))} << 32);
+
+                return BlockMasks{Simd::Details::delimiter_mask_avx2(data, needles, needle_count), non_ascii};
+            }
+        };
+#endif
+
+        // one pass over 64-byte blocks: block_kernel gives the ASCII delimiters and the non-ASCII bytes of a block,
+        // only the non-ASCII bytes are decoded - validated and compared with multi-byte delimiters
+        // (whose bits may continue in the next block)
+        template <typename Tokens, typename BlockKernel>
+        bool split_blocks(std::string_view text, const Delimiters& delimiters, Tokens& tokens, const BlockKernel& block_kernel)
+        {
+            using Simd::Details::block_size;
+
+            Simd::Details::Tokenizer tokenizer{text, tokens};
+            size_t cursor = 0;         // end of the last decoded code point
+            uint64_t carried_bits = 0; // bytes of a delimiter started in the previous block
+
+            for (size_t base = 0; base < text.size(); base += block_size)
+            {
+                const size_t size = std::min(block_size, text.size() - base);
+                auto [mask, non_ascii] = size == block_size ? block_kernel(text.data() + base, delimiters)
+                                                            : block_masks_scalar(text.data() + base, size, delimiters);
+
+                mask |= std::exchange(carried_bits, 0);
+                if (cursor > base) // continuation bytes of a code point from the previous block
+                    non_ascii &= ~((uint64_t{1} << (cursor - base)) - 1);
+
+                while (non_ascii != 0)
+                {
+                    const size_t offset = std::countr_zero(non_ascii);
+                    const size_t length = sequence_length(text, base + offset);
+                    if (length == 0)
+                        return false;
+
+                    const uint64_t bits = ((uint64_t{1} << length) - 1) << offset;
+                    non_ascii &= ~bits;
+
+                    if (!delimiters.multibyte.empty() && delimiters.contains(text.substr(base + offset, length)))
+                    {
+                        mask |= bits;
+                        if (offset + length > block_size)
+                            carried_bits = ((uint64_t{1} << length) - 1) >> (block_size - offset);
+                    }
+
+                    cursor = base + offset + length;
+                }
+
+                tokenizer.consume(mask, base, size);
+            }
+
+            tokenizer.finish();
+            return true;
+        }
+    }
+
+    // offset of the first byte of the first ill-formed sequence - npos if text is valid UTF-8
+    inline size_t find_invalid(std::string_view text)
+    {
+        size_t pos = 0;
+
+        while ((pos = Details::skip_ascii(text, pos)) < text.size())
+        {
+            do
+            {
+                const size_t length = Details::sequence_length(text, pos);
+                if (length == 0)
+                    return pos;
+                pos += length;
+            } while (pos < text.size() && static_cast<unsigned char>(text[pos]) >= 0x80);
+        }
+
+        return std::string_view::npos;
+    }
+
+    inline bool is_valid(std::string_view text)
+    {
+        return find_invalid(text) == std::string_view::npos;
+    }
+
+    // false (tokens in an unspecified state) if text is not valid UTF-8; pattern must be valid UTF-8
+    template <typename Tokens>
+    bool split_text_into(Tokens& tokens, std::string_view text, std::string_view pattern = ", ")
+    {
+        tokens.clear();
+
+        const Details::Delimiters delimiters{pattern};
+
+#ifdef SPLIT_TEXT_HAS_SIMD_KERNELS
+        if (Simd::Details::has_avx2() && delimiters.ascii_bytes.size() <= Simd::Details::max_vector_pattern)
+            return Details::split_blocks(text, delimiters, tokens, Details::Avx2Block{delimiters});
+#endif
+        return Details::split_blocks(text, delimiters, tokens, Details::ScalarBlock{});
+    }
+
+    inline std::optional<std::vector<std::string_view>> split_text(std::string_view text, std::string_view pattern = ", ")
+    {
+        std::vector<std::string_view> tokens;
+
+        if (!split_text_into(tokens, text, pattern))
+            return std::nullopt;
+
+        return tokens;
+    }
+}
+
+#endif
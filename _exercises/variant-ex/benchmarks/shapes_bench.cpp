@@ -0,0 +1,96 @@
+#include <bench.hpp>
+#include <partitioned_collection.hpp>
+#include <shapes.hpp>
+
+#include <numbers>
+#include <random>
+#include <variant>
+#include <vector>
+
+// total area: vector<variant> (dispatch per element) vs. PartitionedCollection (a loop per type)
+
+namespace
+{
+    using Shape = std::variant<Circle, Rectangle, Square>;
+    using Shapes = PartitionedCollection<Circle, Rectangle, Square>;
+
+    double area(const Circle& c)
+    {
+        return std::numbers::pi * c.radius * c.radius;
+    }
+
+    double area(const Rectangle& r)
+    {
+        return static_cast<double>(r.width) * r.height;
+    }
+
+    double area(const Square& s)
+    {
+        return static_cast<double>(s.size) * s.size;
+    }
+
+    std::vector<Shape> make_shapes(size_t size)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<int> type_distribution(0, 2);
+        std::uniform_int_distribution<int> size_distribution(1, 100);
+
+        std::vector<Shape> shapes;
+        shapes.reserve(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            switch (type_distribution(rnd_gen))
+            {
+            case 0:
+                shapes.emplace_back(Circle{size_distribution(rnd_gen)});
+                break;
+            case 1:
+                shapes.emplace_back(Rectangle{size_distribution(rnd_gen), size_distribution(rnd_gen)});
+                break;
+            default:
+                shapes.emplace_back(Square{size_distribution(rnd_gen)});
+            }
+        }
+
+        return shapes;
+    }
+}
+
+BENCHMARK_SUITE("shapes - total area")
+{
+    for (auto size : runner.sizes({1'000'000, 100'000'000}))
+    {
+        const auto shapes = make_shapes(size);
+
+        Shapes partitioned;
+        Shapes ordered(Order::insertion);
+        for (const auto& shape : shapes)
+        {
+            partitioned.push_back(shape);
+            ordered.push_back(shape);
+        }
+
+        runner.run("vector<variant> - std::visit", size, 1, [&] {
+            double total_area = 0.0;
+            for (const auto& shape : shapes)
+                total_area += std::visit([](const auto& s) { return area(s); }, shape);
+            Bench::do_not_optimize(total_area);
+        });
+
+        runner.run("PartitionedCollection - for_each_partition", size, 1, [&] {
+            double total_area = 0.0;
+            partitioned.for_each_partition([&](auto partition) {
+                for (const auto& s : partition)
+                    total_area += area(s);
+            });
+            Bench::do_not_optimize(total_area);
+        });
+
+        runner.run("PartitionedCollection - for_each_in_order", size, 1, [&] {
+            double total_area = 0.0;
+            ordered.for_each_in_order([&](const auto& s) { total_area += area(s); });
+            Bench::do_not_optimize(total_area);
+        });
+    }
+}
@@ -0,0 +1,191 @@
+#ifndef PARTITIONED_COLLECTION_HPP
+#define PARTITIONED_COLLECTION_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// A polymorphic collection that keeps every alternative in its own contiguous vector -
+// an alternative to std::vector<std::variant<Ts...>> without per-element dispatch:
+//
+//   PartitionedCollection<Circle, Rectangle, Square> shapes;
+//   shapes.push_back(Circle{1});
+//   shapes.for_each_partition([&](auto partition) {   // called once per type - a tight loop each
+//       for (const auto& shape : partition)
+//           total_area += area(shape);
+//   });
+//
+// Elements are grouped by type. Construct with Order::insertion to also record the insertion
+// order (one byte per element) - for_each_in_order() then visits elements as they were added.
+
+enum class Order
+{
+    by_type,
+    insertion
+};
+
+namespace PartitionedDetails
+{
+    template <typename T, typename... Ts>
+    constexpr size_t index_of()
+    {
+        constexpr std::array<bool, sizeof...(Ts)> matches{std::is_same_v<T, Ts>...};
+        for (size_t i = 0; i < matches.size(); ++i)
+            if (matches[i])
+                return i;
+        return sizeof...(Ts);
+    }
+}
+
+template <typename... Ts>
+class PartitionedCollection
+{
+    static_assert(sizeof...(Ts) > 0 && sizeof...(Ts) <= 256, "type indexes are stored as uint8_t");
+
+    std::tuple<std::vector<Ts>...> partitions_;
+    Order order_;
+    std::vector<uint8_t> type_indexes_; // insertion order - recorded only for Order::insertion
+
+    template <typename T>
+    static constexpr size_t index_of = PartitionedDetails::index_of<T, Ts...>();
+
+    template <typename T>
+    std::vector<T>& vector_of()
+    {
+        static_assert(index_of<T> < sizeof...(Ts), "T is not stored in this collection");
+        return std::get<index_of<T>>(partitions_);
+    }
+
+    template <typename T>
+    const std::vector<T>& vector_of() const
+    {
+        static_assert(index_of<T> < sizeof...(Ts), "T is not stored in this collection");
+        return std::get<index_of<T>>(partitions_);
+    }
+
+    template <typename T>
+    void record_insertion()
+    {
+        if (order_ == Order::insertion)
+            type_indexes_.push_back(static_cast<uint8_t>(index_of<T>));
+    }
+
+    template <typename Visitor, size_t... Is>
+    void visit_in_order(Visitor& visitor, std::index_sequence<Is...>) const
+    {
+        std::array<size_t, sizeof...(Ts)> cursors{};
+        for (uint8_t type_index : type_indexes_)
+            ((type_index == Is ? (visitor(std::get<Is>(partitions_)[cursors[Is]++]), true) : false) || ...);
+    }
+
+public:
+    using variant_type = std::variant<Ts...>;
+
+    explicit PartitionedCollection(Order order = Order::by_type)
+        : order_{order}
+    {
+    }
+
+    Order order() const
+    {
+        return order_;
+    }
+
+    size_t size() const
+    {
+        return std::apply([](const auto&... partition) { return (partition.size() + ...); }, partitions_);
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    template <typename T>
+    size_t size() const
+    {
+        return vector_of<T>().size();
+    }
+
+    template <typename T>
+    void reserve(size_t count)
+    {
+        vector_of<T>().reserve(count);
+    }
+
+    template <typename T>
+        requires(index_of<std::remove_cvref_t<T>> < sizeof...(Ts))
+    void push_back(T&& item)
+    {
+        vector_of<std::remove_cvref_t<T>>().push_back(std::forward<T>(item));
+        record_insertion<std::remove_cvref_t<T>>();
+    }
+
+    void push_back(const variant_type& item)
+    {
+        std::visit([this](const auto& alternative) { push_back(alternative); }, item);
+    }
+
+    template <typename T, typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        T& item = vector_of<T>().emplace_back(std::forward<Args>(args)...);
+        record_insertion<T>();
+        return item;
+    }
+
+    void clear()
+    {
+        std::apply([](auto&... partition) { (partition.clear(), ...); }, partitions_);
+        type_indexes_.clear();
+    }
+
+    // all elements of type T - contiguous, in insertion order
+    template <typename T>
+    std::span<const T> partition() const
+    {
+        return vector_of<T>();
+    }
+
+    template <typename T>
+    std::span<T> partition()
+    {
+        return vector_of<T>();
+    }
+
+    // visitor(std::span<const T>) - once per type, in the order of Ts
+    template <typename Visitor>
+    void for_each_partition(Visitor&& visitor) const
+    {
+        std::apply([&](const auto&... partition) { (visitor(std::span{partition}), ...); }, partitions_);
+    }
+
+    // visitor(const T&) - elements grouped by type
+    template <typename Visitor>
+    void for_each(Visitor&& visitor) const
+    {
+        for_each_partition([&](auto partition) {
+            for (const auto& item : partition)
+                visitor(item);
+        });
+    }
+
+    // visitor(const T&) - elements in insertion order (dispatch per element)
+    template <typename Visitor>
+    void for_each_in_order(Visitor&& visitor) const
+    {
+        if (order_ != Order::insertion)
+            throw std::logic_error("PartitionedCollection: insertion order is not recorded - construct with Order::insertion");
+
+        visit_in_order(visitor, std::index_sequence_for<Ts...>{});
+    }
+};
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef SHAPES_HPP
+#define SHAPES_HPP
+
+#include <iostream>
+
+struct Circle
+{
+    int radius;
+
+    void draw() const
+    {
+        std::cout << "Drawing Circle with r: " << radius << "\n";
+    }
+};
+
+struct Rectangle
+{
+    int width, height;
+
+    void draw() const
+    {
+        std::cout << "Drawing Rectangle with w: " << width << " & h: " << height << "\n";
+    }
+};
+
+struct Square
+{
+    int size;
+
+    void draw() const
+    {
+        std::cout << "Drawing Square with size: " << size << "\n";
+    }
+};
+
+#endif
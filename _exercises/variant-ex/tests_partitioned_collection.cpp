@@ -0,0 +1,109 @@
+#include "partitioned_collection.hpp"
+#include "shapes.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    double area(const Circle& c)
+    {
+        return numbers::pi * c.radius * c.radius;
+    }
+
+    double area(const Rectangle& r)
+    {
+        return r.width * r.height;
+    }
+
+    double area(const Square& s)
+    {
+        return s.size * s.size;
+    }
+
+    string name(const Circle&)
+    {
+        return "Circle";
+    }
+
+    string name(const Rectangle&)
+    {
+        return "Rectangle";
+    }
+
+    string name(const Square&)
+    {
+        return "Square";
+    }
+}
+
+TEST_CASE("PartitionedCollection")
+{
+    using Shape = variant<Circle, Rectangle, Square>;
+    const vector<Shape> shapes = {Circle{1}, Square{10}, Rectangle{10, 1}, Circle{2}};
+
+    SECTION("one contiguous partition per type")
+    {
+        PartitionedCollection<Circle, Rectangle, Square> collection;
+        for (const auto& shape : shapes)
+            collection.push_back(shape);
+
+        REQUIRE(collection.size() == 4);
+        REQUIRE(collection.size<Circle>() == 2);
+        REQUIRE(collection.partition<Circle>()[1].radius == 2);
+        REQUIRE(collection.partition<Square>()[0].size == 10);
+    }
+
+    SECTION("total area - a loop per type")
+    {
+        PartitionedCollection<Circle, Rectangle, Square> collection;
+        collection.push_back(Circle{1});
+        collection.push_back(Square{10});
+        collection.emplace_back<Rectangle>(10, 1);
+
+        double total_area{};
+        collection.for_each_partition([&](auto partition) {
+            for (const auto& shape : partition)
+                total_area += area(shape);
+        });
+
+        REQUIRE_THAT(total_area, Catch::Matchers::WithinRel(113.14, 0.01));
+    }
+
+    SECTION("for_each groups elements by type")
+    {
+        PartitionedCollection<Circle, Rectangle, Square> collection;
+        for (const auto& shape : shapes)
+            collection.push_back(shape);
+
+        vector<string> names;
+        collection.for_each([&](const auto& shape) { names.push_back(name(shape)); });
+
+        REQUIRE(names == vector<string>{"Circle", "Circle", "Rectangle", "Square"});
+    }
+
+    SECTION("insertion order is preserved on request")
+    {
+        PartitionedCollection<Circle, Rectangle, Square> unordered;
+        REQUIRE_THROWS_AS(unordered.for_each_in_order([](const auto&) {}), logic_error);
+
+        PartitionedCollection<Circle, Rectangle, Square> collection(Order::insertion);
+        for (const auto& shape : shapes)
+            collection.push_back(shape);
+
+        vector<string> names;
+        collection.for_each_in_order([&](const auto& shape) { names.push_back(name(shape)); });
+
+        REQUIRE(names == vector<string>{"Circle", "Square", "Rectangle", "Circle"});
+
+        collection.clear();
+        REQUIRE(collection.empty());
+    }
+}
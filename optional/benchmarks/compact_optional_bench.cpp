@@ -0,0 +1,75 @@
+#include <bench.hpp>
+#include <compact_optional.hpp>
+#include <nullable_column.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // every 10th value missing
+    std::vector<std::optional<int>> make_values(size_t size)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<int> value_distribution(0, 1000);
+
+        std::vector<std::optional<int>> values(size);
+        for (auto& value : values)
+        {
+            const int v = value_distribution(rnd_gen);
+            if (v % 10 != 0)
+                value = v;
+        }
+        return values;
+    }
+}
+
+// counter "bytes" (JSON/CSV) - memory of the container's elements
+BENCHMARK_SUITE("optional columns - memory & scan")
+{
+    for (auto size : runner.sizes({1'000, 1'000'000, 10'000'000}))
+    {
+        const auto optionals = make_values(size);
+
+        const std::vector<MinSentinelOptional<int>> compacts(optionals.begin(), optionals.end());
+
+        NullableColumn<int> column;
+        column.reserve(size);
+        for (const auto& value : optionals)
+            column.push_back(value);
+
+        runner.run("vector<optional<int>> - sum of values", size, 1, [&] {
+            int64_t sum = 0;
+            for (const auto& value : optionals)
+                sum += value.value_or(0);
+            Bench::do_not_optimize(sum);
+        }).counter("bytes", static_cast<double>(optionals.size() * sizeof(std::optional<int>)));
+
+        runner.run("vector<MinSentinelOptional<int>> - sum of values", size, 1, [&] {
+            int64_t sum = 0;
+            for (const auto& value : compacts)
+                sum += value.value_or(0);
+            Bench::do_not_optimize(sum);
+        }).counter("bytes", static_cast<double>(compacts.size() * sizeof(MinSentinelOptional<int>)));
+
+        runner.run("NullableColumn<int> - sum of values()", size, 1, [&] {
+            int64_t sum = 0;
+            for (int value : column.values()) // null rows hold 0
+                sum += value;
+            Bench::do_not_optimize(sum);
+        }).counter("bytes", static_cast<double>(column.size() * sizeof(int) + column.validity().words().size_bytes()));
+
+        runner.run("vector<optional<int>> - count nulls", size, 1, [&] {
+            size_t nulls = 0;
+            for (const auto& value : optionals)
+                nulls += !value.has_value();
+            Bench::do_not_optimize(nulls);
+        });
+
+        runner.run("NullableColumn<int> - count nulls (popcount)", size, 1, [&] {
+            Bench::do_not_optimize(column.null_count());
+        });
+    }
+}
@@ -0,0 +1,93 @@
+#include <bench.hpp>
+#include <person_table.hpp>
+
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    const std::vector<std::string> first_names = {"Jan", "Anna", "Adam", "Katarzyna", "Krzysztof", "Magdalena", "Piotr", "Aleksandra"};
+    const std::vector<std::string> last_names = {"Kowalski", "Nowak", "Wisniewski", "Wojciechowska", "Kaminski",
+                                                 "Lewandowska", "Zielinski", "Szymanska-Dabrowska"};
+
+    // every 3rd person has a middle name
+    std::vector<Person> make_people(size_t size)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<size_t> name_distribution(0, first_names.size() - 1);
+
+        std::vector<Person> people(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            people[i].first_name = first_names[name_distribution(rnd_gen)];
+            if (i % 3 == 0)
+                people[i].middle_name = first_names[name_distribution(rnd_gen)];
+            people[i].last_name = last_names[name_distribution(rnd_gen)];
+        }
+        return people;
+    }
+
+    // sizeof + heap blocks of strings that do not fit in the small string buffer
+    size_t memory_bytes(const std::vector<Person>& people)
+    {
+        auto heap = [](const std::string& text) { return text.capacity() > 15 ? text.capacity() + 1 : 0; };
+
+        size_t bytes = people.capacity() * sizeof(Person);
+        for (const auto& person : people)
+            bytes += heap(person.first_name) + (person.middle_name ? heap(*person.middle_name) : 0) + heap(person.last_name);
+        return bytes;
+    }
+}
+
+// counter "bytes" (JSON/CSV) - memory held by the container
+BENCHMARK_SUITE("PersonTable vs. vector<Person>")
+{
+    for (auto size : runner.sizes({1'000, 1'000'000, 10'000'000}))
+    {
+        const auto people = make_people(size);
+
+        PersonTable table;
+        table.reserve(size);
+        for (const auto& person : people)
+            table.push_back(person);
+
+        runner.run("vector<Person> - build", size, 1, [&] {
+            std::vector<Person> copy(people.begin(), people.end());
+            Bench::do_not_optimize(copy.data());
+        }).counter("bytes", static_cast<double>(memory_bytes(people)));
+
+        runner.run("PersonTable - build", size, 1, [&] {
+            PersonTable copy;
+            copy.reserve(size);
+            for (const auto& person : people)
+                copy.push_back(person);
+            Bench::do_not_optimize(copy.size());
+        }).counter("bytes", static_cast<double>(table.memory_bytes()));
+
+        runner.run("vector<Person> - filter last name & middle name", size, 1, [&] {
+            size_t count = 0;
+            for (const auto& person : people)
+                count += person.last_name == "Kowalski" && person.middle_name.has_value();
+            Bench::do_not_optimize(count);
+        });
+
+        runner.run("PersonTable - filter with row views", size, 1, [&] {
+            size_t count = 0;
+            for (auto [first_name, middle_name, last_name] : table)
+                count += last_name == "Kowalski" && middle_name.has_value();
+            Bench::do_not_optimize(count);
+        });
+
+        runner.run("PersonTable - filter on columns", size, 1, [&] {
+            const auto& last = table.last_names();
+            const auto& has_middle = table.has_middle_name();
+            size_t count = 0;
+            for (size_t row = 0; row < table.size(); ++row)
+                count += has_middle.test(row) && last[row] == "Kowalski";
+            Bench::do_not_optimize(count);
+        });
+    }
+}
@@ -0,0 +1,179 @@
+#ifndef COMPACT_OPTIONAL_HPP
+#define COMPACT_OPTIONAL_HPP
+
+#include <concepts>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+// Optional without the extra flag - "empty" is a value T can hold but the caller never uses (a sentinel or a niche):
+//   sizeof(CompactOptional<T, Policy>) == sizeof(T), so vector<CompactOptional<int, ...>> is as dense as vector<int>
+//   the interface follows std::optional: has_value(), *, value(), value_or(), reset(), emplace(), == nullopt
+//
+//   SentinelOptional<int, -1> index;           // -1 means "no index"
+//   NaNOptional<double> price = 9.99;          // any NaN means "no price"
+//   MinSentinelOptional<int> temperature;      // INT_MIN is the empty state (signed integers only)
+// Storing the empty value itself throws std::invalid_argument - it would silently turn into nullopt.
+
+template <typename T, T Sentinel>
+struct SentinelPolicy
+{
+    static constexpr T empty_value() noexcept
+    {
+        return Sentinel;
+    }
+
+    static constexpr bool is_empty(const T& value) noexcept
+    {
+        return value == Sentinel;
+    }
+};
+
+template <typename T>
+struct NaNPolicy
+{
+    static_assert(std::numeric_limits<T>::has_quiet_NaN);
+
+    static constexpr T empty_value() noexcept
+    {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+
+    static constexpr bool is_empty(const T& value) noexcept
+    {
+        return value != value; // every NaN
+    }
+};
+
+template <typename T, typename Policy>
+class CompactOptional
+{
+    T value_;
+
+    static constexpr const T& checked(const T& value)
+    {
+        if (Policy::is_empty(value))
+            throw std::invalid_argument("CompactOptional: the empty value cannot be stored");
+        return value;
+    }
+
+public:
+    using value_type = T;
+
+    constexpr CompactOptional() noexcept
+        : value_{Policy::empty_value()}
+    {
+    }
+
+    constexpr CompactOptional(std::nullopt_t) noexcept
+        : CompactOptional()
+    {
+    }
+
+    constexpr CompactOptional(const T& value)
+        : value_{checked(value)}
+    {
+    }
+
+    constexpr CompactOptional(const std::optional<T>& other)
+        : value_{other ? checked(*other) : Policy::empty_value()}
+    {
+    }
+
+    constexpr CompactOptional& operator=(std::nullopt_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    constexpr CompactOptional& operator=(const T& value)
+    {
+        value_ = checked(value);
+        return *this;
+    }
+
+    constexpr bool has_value() const noexcept
+    {
+        return !Policy::is_empty(value_);
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    // unchecked - as std::optional
+    constexpr const T& operator*() const noexcept
+    {
+        return value_;
+    }
+
+    constexpr const T* operator->() const noexcept
+    {
+        return &value_;
+    }
+
+    constexpr const T& value() const
+    {
+        if (!has_value())
+            throw std::bad_optional_access{};
+        return value_;
+    }
+
+    template <typename U>
+    constexpr T value_or(U&& default_value) const
+    {
+        return has_value() ? value_ : static_cast<T>(std::forward<U>(default_value));
+    }
+
+    constexpr void reset() noexcept
+    {
+        value_ = Policy::empty_value();
+    }
+
+    template <typename... Args>
+    constexpr const T& emplace(Args&&... args)
+    {
+        value_ = checked(T(std::forward<Args>(args)...));
+        return value_;
+    }
+
+    constexpr void swap(CompactOptional& other) noexcept
+    {
+        std::swap(value_, other.value_);
+    }
+
+    constexpr operator std::optional<T>() const
+    {
+        return has_value() ? std::optional<T>{value_} : std::nullopt;
+    }
+
+    friend constexpr bool operator==(const CompactOptional& optional, std::nullopt_t) noexcept
+    {
+        return !optional.has_value();
+    }
+
+    // empty == empty, as std::optional - also for NaN
+    friend constexpr bool operator==(const CompactOptional& a, const CompactOptional& b) noexcept
+    {
+        return a.has_value() == b.has_value() && (!a.has_value() || a.value_ == b.value_);
+    }
+
+    friend constexpr bool operator==(const CompactOptional& optional, const T& value) noexcept
+    {
+        return optional.has_value() && optional.value_ == value;
+    }
+};
+
+template <typename T, T Sentinel>
+using SentinelOptional = CompactOptional<T, SentinelPolicy<T, Sentinel>>;
+
+// numeric_limits<T>::min() is 0 for unsigned and the smallest positive normal for floating-point types
+template <std::signed_integral T>
+using MinSentinelOptional = SentinelOptional<T, std::numeric_limits<T>::min()>;
+
+template <typename T>
+using NaNOptional = CompactOptional<T, NaNPolicy<T>>;
+
+#endif
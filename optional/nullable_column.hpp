@@ -0,0 +1,210 @@
+#ifndef NULLABLE_COLUMN_HPP
+#define NULLABLE_COLUMN_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+// Column of optional values stored as two dense arrays (the Arrow layout):
+//   - values: T for every row - a null row holds T{}, so sums and vectorized scans need no branch
+//   - validity: ValidityBitmap - one bit per row (1/64 of a std::optional<int> flag with its padding)
+//
+//   NullableColumn<int> ages;
+//   ages.push_back(42);
+//   ages.push_back(std::nullopt);
+//   std::optional<int> first = ages[0];
+//   ages.for_each_value([&](size_t row, int age) { ... }); // valid rows only, 64 rows per bitmap word
+
+class ValidityBitmap
+{
+    std::vector<uint64_t> words_;
+    size_t size_ = 0;
+
+public:
+    ValidityBitmap() = default;
+
+    explicit ValidityBitmap(size_t size, bool valid = false)
+        : words_((size + 63) / 64, valid ? ~uint64_t{0} : 0)
+        , size_{size}
+    {
+        clear_padding();
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool test(size_t index) const
+    {
+        return (words_[index / 64] >> (index % 64)) & 1;
+    }
+
+    void set(size_t index, bool valid = true)
+    {
+        const uint64_t bit = uint64_t{1} << (index % 64);
+        if (valid)
+            words_[index / 64] |= bit;
+        else
+            words_[index / 64] &= ~bit;
+    }
+
+    void push_back(bool valid)
+    {
+        if (size_ % 64 == 0)
+            words_.push_back(0);
+        words_.back() |= uint64_t{valid} << (size_ % 64);
+        ++size_;
+    }
+
+    void reserve(size_t size)
+    {
+        words_.reserve((size + 63) / 64);
+    }
+
+    // number of set bits
+    size_t count() const
+    {
+        size_t result = 0;
+        for (uint64_t word : words_)
+            result += std::popcount(word);
+        return result;
+    }
+
+    // bits past size() are always 0
+    std::span<const uint64_t> words() const
+    {
+        return words_;
+    }
+
+    // f(index) for every set bit in ascending order
+    template <typename Function>
+    void for_each_set(Function f) const
+    {
+        for (size_t w = 0; w < words_.size(); ++w)
+        {
+            for (uint64_t word = words_[w]; word != 0; word &= word - 1)
+                f(w * 64 + std::countr_zero(word));
+        }
+    }
+
+private:
+    void clear_padding()
+    {
+        if (size_ % 64 != 0)
+            words_.back() &= (uint64_t{1} << (size_ % 64)) - 1;
+    }
+};
+
+template <typename T>
+class NullableColumn
+{
+    std::vector<T> values_;
+    ValidityBitmap validity_;
+
+public:
+    using value_type = std::optional<T>;
+
+    NullableColumn() = default;
+
+    // size null rows
+    explicit NullableColumn(size_t size)
+        : values_(size)
+        , validity_(size)
+    {
+    }
+
+    size_t size() const
+    {
+        return values_.size();
+    }
+
+    bool empty() const
+    {
+        return values_.empty();
+    }
+
+    void reserve(size_t size)
+    {
+        values_.reserve(size);
+        validity_.reserve(size);
+    }
+
+    void push_back(const T& value)
+    {
+        values_.push_back(value);
+        validity_.push_back(true);
+    }
+
+    void push_back(std::nullopt_t)
+    {
+        values_.push_back(T{});
+        validity_.push_back(false);
+    }
+
+    void push_back(const std::optional<T>& value)
+    {
+        if (value)
+            push_back(*value);
+        else
+            push_back(std::nullopt);
+    }
+
+    bool has_value(size_t row) const
+    {
+        return validity_.test(row);
+    }
+
+    std::optional<T> operator[](size_t row) const
+    {
+        return has_value(row) ? std::optional<T>{values_[row]} : std::nullopt;
+    }
+
+    std::optional<T> at(size_t row) const
+    {
+        if (row >= size())
+            throw std::out_of_range("NullableColumn: row out of range");
+        return (*this)[row];
+    }
+
+    void set(size_t row, const T& value)
+    {
+        values_[row] = value;
+        validity_.set(row, true);
+    }
+
+    void set(size_t row, std::nullopt_t)
+    {
+        values_[row] = T{};
+        validity_.set(row, false);
+    }
+
+    size_t null_count() const
+    {
+        return size() - validity_.count();
+    }
+
+    // T{} in null rows
+    std::span<const T> values() const
+    {
+        return values_;
+    }
+
+    const ValidityBitmap& validity() const
+    {
+        return validity_;
+    }
+
+    // f(row, value) for non-null rows
+    template <typename Function>
+    void for_each_value(Function f) const
+    {
+        validity_.for_each_set([&](size_t row) { f(row, values_[row]); });
+    }
+};
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef PERSON_HPP
+#define PERSON_HPP
+
+#include <optional>
+#include <string>
+
+struct Person
+{
+    std::string first_name;
+    std::optional<std::string> middle_name;
+    std::string last_name;
+};
+
+#endif
@@ -0,0 +1,261 @@
+#ifndef PERSON_TABLE_HPP
+#define PERSON_TABLE_HPP
+
+#include "nullable_column.hpp"
+#include "person.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// Person records stored column by column (struct of arrays) - no heap allocation per record:
+//   - every string column is one contiguous character buffer + 32-bit end offsets
+//   - middle_name presence is a ValidityBitmap (a missing middle name stores no characters)
+//   - table[row] is a PersonRef - a lightweight view with accessors and structured bindings
+//
+//   PersonTable people;
+//   people.push_back(Person{"Jan", std::nullopt, "Kowalski"});
+//   for (auto [first_name, middle_name, last_name] : people)
+//       if (last_name == "Kowalski" && middle_name)
+//           ...
+// Views returned by a PersonRef are invalidated by push_back (like pointers into a vector).
+
+// strings appended to one buffer - string i is chars_[offsets_[i], offsets_[i + 1])
+class StringColumn
+{
+    std::vector<char> chars_;
+    std::vector<uint32_t> offsets_{0};
+
+public:
+    size_t size() const
+    {
+        return offsets_.size() - 1;
+    }
+
+    void reserve(size_t count, size_t total_chars)
+    {
+        offsets_.reserve(count + 1);
+        chars_.reserve(total_chars);
+    }
+
+    void push_back(std::string_view text)
+    {
+        if (chars_.size() + text.size() > std::numeric_limits<uint32_t>::max())
+            throw std::length_error("StringColumn: more than 4 GB of characters");
+
+        chars_.insert(chars_.end(), text.begin(), text.end());
+        offsets_.push_back(static_cast<uint32_t>(chars_.size()));
+    }
+
+    std::string_view operator[](size_t index) const
+    {
+        return std::string_view(chars_.data() + offsets_[index], offsets_[index + 1] - offsets_[index]);
+    }
+
+    size_t memory_bytes() const
+    {
+        return chars_.capacity() * sizeof(char) + offsets_.capacity() * sizeof(uint32_t);
+    }
+};
+
+class PersonTable;
+
+class PersonRef
+{
+    const PersonTable* table_;
+    size_t row_;
+
+public:
+    PersonRef(const PersonTable& table, size_t row)
+        : table_{&table}
+        , row_{row}
+    {
+    }
+
+    size_t row() const
+    {
+        return row_;
+    }
+
+    std::string_view first_name() const;
+    std::optional<std::string_view> middle_name() const;
+    std::string_view last_name() const;
+
+    Person to_person() const
+    {
+        const auto middle = middle_name();
+        return Person{std::string(first_name()), middle ? std::optional<std::string>(*middle) : std::nullopt, std::string(last_name())};
+    }
+
+    // structured bindings: auto [first_name, middle_name, last_name] = table[row];
+    template <size_t Index>
+    auto get() const
+    {
+        if constexpr (Index == 0)
+            return first_name();
+        else if constexpr (Index == 1)
+            return middle_name();
+        else
+            return last_name();
+    }
+};
+
+template <>
+struct std::tuple_size<PersonRef> : std::integral_constant<size_t, 3>
+{
+};
+
+template <size_t Index>
+struct std::tuple_element<Index, PersonRef>
+{
+    using type = decltype(std::declval<PersonRef>().get<Index>());
+};
+
+class PersonTable
+{
+    StringColumn first_names_;
+    StringColumn middle_names_; // empty for rows without a middle name
+    StringColumn last_names_;
+    ValidityBitmap has_middle_name_;
+
+    friend class PersonRef;
+
+public:
+    class iterator
+    {
+        const PersonTable* table_ = nullptr;
+        size_t row_ = 0;
+
+    public:
+        using value_type = PersonRef;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        iterator(const PersonTable& table, size_t row)
+            : table_{&table}
+            , row_{row}
+        {
+        }
+
+        PersonRef operator*() const
+        {
+            return PersonRef{*table_, row_};
+        }
+
+        iterator& operator++()
+        {
+            ++row_;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator previous = *this;
+            ++row_;
+            return previous;
+        }
+
+        bool operator==(const iterator& other) const
+        {
+            return row_ == other.row_;
+        }
+    };
+
+    size_t size() const
+    {
+        return first_names_.size();
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    // rows & expected characters per row (all three names)
+    void reserve(size_t rows, size_t chars_per_row = 24)
+    {
+        first_names_.reserve(rows, rows * chars_per_row / 3);
+        middle_names_.reserve(rows, rows * chars_per_row / 6);
+        last_names_.reserve(rows, rows * chars_per_row / 2);
+        has_middle_name_.reserve(rows);
+    }
+
+    void push_back(std::string_view first_name, std::optional<std::string_view> middle_name, std::string_view last_name)
+    {
+        first_names_.push_back(first_name);
+        middle_names_.push_back(middle_name.value_or(std::string_view{}));
+        last_names_.push_back(last_name);
+        has_middle_name_.push_back(middle_name.has_value());
+    }
+
+    void push_back(const Person& person)
+    {
+        push_back(person.first_name,
+                  person.middle_name ? std::optional<std::string_view>(*person.middle_name) : std::nullopt,
+                  person.last_name);
+    }
+
+    PersonRef operator[](size_t row) const
+    {
+        return PersonRef{*this, row};
+    }
+
+    iterator begin() const
+    {
+        return iterator{*this, 0};
+    }
+
+    iterator end() const
+    {
+        return iterator{*this, size()};
+    }
+
+    // whole columns - full scans touch only the column they filter on
+    const StringColumn& first_names() const
+    {
+        return first_names_;
+    }
+
+    const StringColumn& last_names() const
+    {
+        return last_names_;
+    }
+
+    const ValidityBitmap& has_middle_name() const
+    {
+        return has_middle_name_;
+    }
+
+    size_t memory_bytes() const
+    {
+        return first_names_.memory_bytes() + middle_names_.memory_bytes() + last_names_.memory_bytes()
+             + has_middle_name_.words().size_bytes();
+    }
+};
+
+inline std::string_view PersonRef::first_name() const
+{
+    return table_->first_names_[row_];
+}
+
+inline std::optional<std::string_view> PersonRef::middle_name() const
+{
+    if (!table_->has_middle_name_.test(row_))
+        return std::nullopt;
+    return table_->middle_names_[row_];
+}
+
+inline std::string_view PersonRef::last_name() const
+{
+    return table_->last_names_[row_];
+}
+
+#endif
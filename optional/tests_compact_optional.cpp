@@ -0,0 +1,146 @@
+#include "compact_optional.hpp"
+#include "nullable_column.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+static_assert(sizeof(SentinelOptional<int, -1>) == sizeof(int));
+static_assert(sizeof(NaNOptional<double>) == sizeof(double));
+
+template <typename T>
+concept HasMinSentinelOptional = requires { typename MinSentinelOptional<T>; };
+
+static_assert(HasMinSentinelOptional<int> && HasMinSentinelOptional<long long>);
+static_assert(!HasMinSentinelOptional<unsigned> && !HasMinSentinelOptional<double>);
+
+TEST_CASE("CompactOptional")
+{
+    SECTION("std::optional interface")
+    {
+        SentinelOptional<int, -1> index;
+
+        REQUIRE_FALSE(index.has_value());
+        REQUIRE(index == nullopt);
+        REQUIRE(index.value_or(0) == 0);
+        REQUIRE_THROWS_AS(index.value(), bad_optional_access);
+
+        index = 42;
+
+        REQUIRE(index);
+        REQUIRE(*index == 42);
+        REQUIRE(index == 42);
+        REQUIRE(index.value() == 42);
+
+        index.reset();
+        REQUIRE_FALSE(index);
+
+        index.emplace(7);
+        REQUIRE(index == SentinelOptional<int, -1>{7});
+    }
+
+    SECTION("the sentinel cannot be stored")
+    {
+        REQUIRE_THROWS_AS((SentinelOptional<int, -1>{-1}), invalid_argument);
+        REQUIRE_THROWS_AS(MinSentinelOptional<int>{numeric_limits<int>::min()}, invalid_argument);
+    }
+
+    SECTION("NaN as the empty state")
+    {
+        NaNOptional<double> price;
+        REQUIRE(price == nullopt);
+        REQUIRE(price == NaNOptional<double>{}); // empty == empty, even though NaN != NaN
+
+        price = 9.99;
+        REQUIRE(price == 9.99);
+        REQUIRE_THROWS_AS(price = nan(""), invalid_argument);
+        REQUIRE(price == 9.99);
+    }
+
+    SECTION("conversions from & to std::optional")
+    {
+        const optional<int> value = 5;
+        const MinSentinelOptional<int> compact = value;
+
+        REQUIRE(compact == 5);
+        REQUIRE(optional<int>(compact) == value);
+        REQUIRE(optional<int>(MinSentinelOptional<int>{}) == nullopt);
+    }
+}
+
+TEST_CASE("ValidityBitmap")
+{
+    ValidityBitmap bitmap(130, true);
+
+    REQUIRE(bitmap.count() == 130);
+    REQUIRE(bitmap.words().size() == 3);
+    REQUIRE(bitmap.words().back() == 0b11); // no bits past size()
+
+    bitmap.set(1, false);
+    bitmap.set(129, false);
+    bitmap.push_back(true);
+
+    REQUIRE(bitmap.size() == 131);
+    REQUIRE(bitmap.count() == 129);
+    REQUIRE_FALSE(bitmap.test(1));
+    REQUIRE(bitmap.test(130));
+}
+
+TEST_CASE("NullableColumn")
+{
+    NullableColumn<int> column;
+    for (int i = 0; i < 200; ++i)
+    {
+        if (i % 3 == 0)
+            column.push_back(nullopt);
+        else
+            column.push_back(i);
+    }
+
+    SECTION("optional access")
+    {
+        REQUIRE(column.size() == 200);
+        REQUIRE(column[0] == nullopt);
+        REQUIRE(column[1] == 1);
+        REQUIRE(column.null_count() == 67);
+        REQUIRE_THROWS_AS(column.at(200), out_of_range);
+    }
+
+    SECTION("null rows hold T{} - sums need no branch")
+    {
+        const auto values = column.values();
+        int expected = 0;
+        column.for_each_value([&](size_t, int value) { expected += value; });
+
+        REQUIRE(accumulate(values.begin(), values.end(), 0) == expected);
+    }
+
+    SECTION("for_each_value visits valid rows in order")
+    {
+        vector<size_t> rows;
+        column.for_each_value([&](size_t row, int value) {
+            REQUIRE(static_cast<size_t>(value) == row);
+            rows.push_back(row);
+        });
+
+        REQUIRE(rows.size() == 133);
+        REQUIRE(is_sorted(rows.begin(), rows.end()));
+    }
+
+    SECTION("set")
+    {
+        column.set(0, 100);
+        column.set(1, nullopt);
+
+        REQUIRE(column[0] == 100);
+        REQUIRE(column[1] == nullopt);
+        REQUIRE(column.values()[1] == 0);
+    }
+}
@@ -1,3 +1,5 @@
+#include "person.hpp"
+
 #include <algorithm>
 #include <array>
 #include <atomic>
@@ -54,13 +56,6 @@ std::optional<const char*> maybe_getenv(const char* n)
         return std::nullopt;
 }
 
-struct Person
-{
-    std::string first_name;
-    std::optional<std::string> middle_name;
-    std::string last_name;
-};
-
 TEST_CASE("using optional")
 {
     std::optional path = maybe_getenv("PATH");
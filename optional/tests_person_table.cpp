@@ -0,0 +1,67 @@
+#include "person_table.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("PersonTable")
+{
+    const vector<Person> people = {{"Jan", nullopt, "Kowalski"}, {"Anna", "Maria"s, "Nowak"}, {"Adam", ""s, "Kowalski"}};
+
+    PersonTable table;
+    for (const auto& person : people)
+        table.push_back(person);
+
+    SECTION("row accessors")
+    {
+        REQUIRE(table.size() == 3);
+        REQUIRE(table[0].first_name() == "Jan");
+        REQUIRE(table[0].middle_name() == nullopt);
+        REQUIRE(table[1].middle_name() == "Maria"sv);
+        REQUIRE(table[2].middle_name() == ""sv); // empty, but present
+        REQUIRE(table[2].last_name() == "Kowalski");
+    }
+
+    SECTION("structured bindings")
+    {
+        auto [first_name, middle_name, last_name] = table[1];
+
+        REQUIRE(first_name == "Anna");
+        REQUIRE(middle_name == "Maria"sv);
+        REQUIRE(last_name == "Nowak");
+    }
+
+    SECTION("range-for over rows")
+    {
+        static_assert(std::input_iterator<PersonTable::iterator>);
+
+        vector<string_view> kowalscy;
+        for (auto [first_name, middle_name, last_name] : table)
+            if (last_name == "Kowalski")
+                kowalscy.push_back(first_name);
+
+        REQUIRE(kowalscy == vector<string_view>{"Jan", "Adam"});
+    }
+
+    SECTION("round trip to Person")
+    {
+        for (size_t row = 0; row < people.size(); ++row)
+        {
+            const Person person = table[row].to_person();
+            REQUIRE(person.first_name == people[row].first_name);
+            REQUIRE(person.middle_name == people[row].middle_name);
+            REQUIRE(person.last_name == people[row].last_name);
+        }
+    }
+
+    SECTION("columns")
+    {
+        REQUIRE(table.last_names()[1] == "Nowak");
+        REQUIRE(table.has_middle_name().count() == 2);
+    }
+}
@@ -0,0 +1,100 @@
+#include <bench.hpp>
+#include <tbb_memory_resource.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <string>
+
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+
+namespace
+{
+    constexpr size_t live_blocks = 64;
+
+    struct Block
+    {
+        void* ptr = nullptr;
+        size_t size = 0;
+    };
+
+    size_t block_size(size_t i)
+    {
+        return 16 + (i * 0x9E3779B97F4A7C15ULL >> 54); // 16 .. 1039 bytes
+    }
+
+    // every task keeps a window of live blocks - each new allocation frees the oldest one
+    void churn(std::pmr::memory_resource& resource, size_t allocations, size_t seed, std::function<void()> on_window_end = {})
+    {
+        std::array<Block, live_blocks> window{};
+
+        for (size_t i = 0; i < allocations; ++i)
+        {
+            auto& block = window[i % live_blocks];
+            if (block.ptr)
+                resource.deallocate(block.ptr, block.size);
+
+            block.size = block_size(seed + i);
+            block.ptr = resource.allocate(block.size);
+            static_cast<std::byte*>(block.ptr)[0] = std::byte{1};
+
+            if (on_window_end && i % live_blocks == live_blocks - 1)
+            {
+                window = {};
+                on_window_end();
+            }
+        }
+
+        for (auto& block : window)
+            if (block.ptr)
+                resource.deallocate(block.ptr, block.size);
+    }
+
+    template <typename PerTask>
+    void run_tasks(size_t allocations, unsigned threads, PerTask per_task)
+    {
+        const size_t tasks = threads * 4;
+        tbb::parallel_for(size_t{0}, tasks, [&](size_t task) { per_task(allocations / tasks, task * allocations); });
+    }
+}
+
+BENCHMARK_SUITE("allocation churn - malloc vs. tbbmalloc vs. pmr resources")
+{
+    for (auto size : runner.sizes({1'000'000, 10'000'000}))
+    {
+        for (auto threads : runner.thread_counts())
+        {
+            tbb::global_control limit{tbb::global_control::max_allowed_parallelism, threads};
+
+            runner.run("new_delete_resource (malloc)", size, threads, [&] {
+                run_tasks(size, threads, [](size_t n, size_t seed) { churn(*std::pmr::new_delete_resource(), n, seed); });
+            });
+
+            runner.run("scalable_memory_resource (tbbmalloc)", size, threads, [&] {
+                run_tasks(size, threads, [](size_t n, size_t seed) { churn(*tbb::scalable_memory_resource(), n, seed); });
+            });
+
+            runner.run("synchronized_pool_resource (shared)", size, threads, [&] {
+                std::pmr::synchronized_pool_resource pool;
+                run_tasks(size, threads, [&](size_t n, size_t seed) { churn(pool, n, seed); });
+            });
+
+            runner.run("unsynchronized_pool_resource (per task)", size, threads, [&] {
+                run_tasks(size, threads, [](size_t n, size_t seed) {
+                    std::pmr::unsynchronized_pool_resource pool{tbb::scalable_memory_resource()};
+                    churn(pool, n, seed);
+                });
+            });
+
+            runner.run("monotonic_buffer_resource (per task)", size, threads, [&] {
+                run_tasks(size, threads, [](size_t n, size_t seed) {
+                    std::pmr::monotonic_buffer_resource arena{tbb::scalable_memory_resource()};
+                    churn(arena, n, seed, [&arena] { arena.release(); });
+                });
+            });
+        }
+    }
+}
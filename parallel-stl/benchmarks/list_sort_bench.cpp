@@ -0,0 +1,58 @@
+#include <bench.hpp>
+#include <data_generator.hpp>
+#include <list_sort.hpp>
+
+#include <array>
+#include <forward_list>
+#include <list>
+#include <vector>
+
+#include <tbb/global_control.h>
+
+namespace
+{
+    struct Record
+    {
+        int key;
+        std::array<char, 60> payload{};
+
+        bool operator<(const Record& other) const
+        {
+            return key < other.key;
+        }
+    };
+
+    template <typename TList, typename Sort>
+    void run_list_sort(Bench::Runner& runner, const std::string& name, const std::vector<int>& keys, unsigned threads, Sort sort)
+    {
+        TList lst;
+        const auto reset = [&] {
+            lst.clear();
+            for (auto it = keys.rbegin(); it != keys.rend(); ++it)
+                lst.push_front(typename TList::value_type{*it});
+        };
+
+        runner.run(name, keys.size(), threads, reset, [&] { sort(lst); });
+    }
+}
+
+BENCHMARK_SUITE("list sort - list::sort vs. parallel_sort")
+{
+    for (auto size : runner.sizes({100'000, 1'000'000, 10'000'000}))
+    {
+        const auto keys = DataGenerator::uniform<int>(size, 0, 1'000'000'000, 42);
+
+        run_list_sort<std::list<int>>(runner, "list<int>::sort", keys, 1, [](auto& lst) { lst.sort(); });
+        run_list_sort<std::list<Record>>(runner, "list<Record>::sort", keys, 1, [](auto& lst) { lst.sort(); });
+        run_list_sort<std::forward_list<int>>(runner, "forward_list<int>::sort", keys, 1, [](auto& lst) { lst.sort(); });
+
+        for (auto threads : runner.thread_counts())
+        {
+            tbb::global_control limit{tbb::global_control::max_allowed_parallelism, threads};
+
+            run_list_sort<std::list<int>>(runner, "parallel_sort(list<int>)", keys, threads, [](auto& lst) { parallel_sort(lst); });
+            run_list_sort<std::list<Record>>(runner, "parallel_sort(list<Record>)", keys, threads, [](auto& lst) { parallel_sort(lst); });
+            run_list_sort<std::forward_list<int>>(runner, "parallel_sort(forward_list<int>)", keys, threads, [](auto& lst) { parallel_sort(lst); });
+        }
+    }
+}
@@ -0,0 +1,137 @@
+#include <bench.hpp>
+#include <data_generator.hpp>
+#include <execution_context.hpp>
+#include <tbb_memory_resource.hpp>
+
+#include <algorithm>
+#include <execution>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tbb/global_control.h>
+
+namespace
+{
+    // input, work and output vectors all use the allocator of data
+    template <typename ExecutionPolicy, typename Allocator>
+    void run_algorithms(Bench::Runner& runner, ExecutionPolicy&& policy, std::string_view policy_name,
+                        const std::vector<int, Allocator>& data, unsigned threads)
+    {
+        using SumAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<long long>;
+
+        const size_t size = data.size();
+        auto name = [policy_name](std::string_view algorithm) { return std::string(algorithm) + "/" + std::string(policy_name); };
+
+        std::vector<int, Allocator> work(size, data.get_allocator());
+        auto reset_work = [&] { std::copy(data.begin(), data.end(), work.begin()); };
+
+        runner.run(name("sort"), size, threads, reset_work, [&] {
+            std::sort(policy, work.begin(), work.end());
+        });
+
+        runner.run(name("stable_sort"), size, threads, reset_work, [&] {
+            std::stable_sort(policy, work.begin(), work.end());
+        });
+
+        runner.run(name("reduce"), size, threads, [&] {
+            Bench::do_not_optimize(std::reduce(policy, data.begin(), data.end(), 0LL));
+        });
+
+        runner.run(name("transform_reduce"), size, threads, [&] {
+            Bench::do_not_optimize(std::transform_reduce(policy, data.begin(), data.end(), 0.0, std::plus<>{},
+                                                         [](int x) { return static_cast<double>(x) * x; }));
+        });
+
+        std::vector<long long, SumAllocator> partial_sums(size, SumAllocator{data.get_allocator()});
+        runner.run(name("inclusive_scan"), size, threads, [&] {
+            std::inclusive_scan(policy, data.begin(), data.end(), partial_sums.begin(), std::plus<long long>{}, 0LL);
+            Bench::do_not_optimize(partial_sums.back());
+        });
+
+        runner.run(name("for_each"), size, threads, reset_work, [&] {
+            std::for_each(policy, work.begin(), work.end(), [](int& x) { x = x / 3 + 1; });
+            Bench::do_not_optimize(work.front());
+        });
+    }
+}
+
+BENCHMARK_SUITE("parallel-stl algorithms")
+{
+    for (auto size : runner.sizes({1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000}))
+    {
+        const auto data = DataGenerator::permutation<int>(size, 42);
+        const auto tbb_data = DataGenerator::permutation<int>(size, 42, std::pmr::polymorphic_allocator<int>{tbb::scalable_memory_resource()});
+
+        run_algorithms(runner, std::execution::seq, "seq", data, 1);
+
+        for (auto threads : runner.thread_counts())
+        {
+            tbb::global_control limit{tbb::global_control::max_allowed_parallelism, threads};
+
+            run_algorithms(runner, std::execution::par, "par", data, threads);
+            run_algorithms(runner, std::execution::par_unseq, "par_unseq", data, threads);
+
+            // the same workloads with containers on tbbmalloc (scratch memory of the algorithms still comes from operator new)
+            run_algorithms(runner, std::execution::par, "par/tbbmalloc", tbb_data, threads);
+            run_algorithms(runner, std::execution::par_unseq, "par_unseq/tbbmalloc", tbb_data, threads);
+        }
+    }
+}
+
+BENCHMARK_SUITE("data generation - iota + shuffle vs. counter-based RNG")
+{
+    for (auto size : runner.sizes({1'000'000, 10'000'000, 100'000'000}))
+    {
+        runner.run("iota+shuffle/mt19937", size, 1, [&] {
+            std::vector<int> data(size);
+            std::iota(data.begin(), data.end(), 0);
+            std::mt19937 rnd_gen(42);
+            std::shuffle(data.begin(), data.end(), rnd_gen);
+            Bench::do_not_optimize(data.data());
+        });
+
+        for (auto threads : runner.thread_counts())
+        {
+            tbb::global_control limit{tbb::global_control::max_allowed_parallelism, threads};
+
+            runner.run("DataGenerator::permutation", size, threads, [&] {
+                Bench::do_not_optimize(DataGenerator::permutation<int>(size, 42).data());
+            });
+
+            runner.run("DataGenerator::uniform", size, threads, [&] {
+                Bench::do_not_optimize(DataGenerator::uniform<int>(size, 0, 1'000'000, 42).data());
+            });
+        }
+    }
+}
+
+BENCHMARK_SUITE("sort in ExecutionContext - arena scaling efficiency")
+{
+    for (auto size : runner.sizes({10'000'000}))
+    {
+        const auto data = DataGenerator::permutation<int>(size, 42);
+        std::vector<int> work(size);
+
+        for (auto threads : runner.thread_counts())
+        {
+            ExecutionContext ctx{static_cast<int>(threads)};
+
+            auto reset = [&] {
+                std::copy(data.begin(), data.end(), work.begin());
+                ctx.reset_stats();
+            };
+
+            auto& result = runner.run("sort/par_unseq/arena", size, threads, reset, [&] {
+                ctx.execute([&] { std::sort(std::execution::par_unseq, work.begin(), work.end()); });
+            });
+
+            result.counter("arena_utilization", ctx.utilization());
+        }
+    }
+}
@@ -0,0 +1,111 @@
+#include <bench.hpp>
+#include <data_generator.hpp>
+#include <radix_sort.hpp>
+#include <tbb_memory_resource.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <execution>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <tbb/global_control.h>
+
+namespace
+{
+    template <typename T>
+    std::vector<T> make_random(size_t size)
+    {
+        return DataGenerator::uniform<T>(size, std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), 42);
+    }
+
+    template <typename T>
+    void compare_sorts(Bench::Runner& runner, const std::string& type_name, size_t size)
+    {
+        const auto data = make_random<T>(size);
+        std::vector<T> work(size);
+        auto reset_work = [&] { std::copy(data.begin(), data.end(), work.begin()); };
+
+        for (auto threads : runner.thread_counts())
+        {
+            tbb::global_control limit{tbb::global_control::max_allowed_parallelism, threads};
+
+            runner.run("std::sort/par_unseq/" + type_name, size, threads, reset_work, [&] {
+                std::sort(std::execution::par_unseq, work.begin(), work.end());
+            });
+
+            runner.run("radix_sort/par/" + type_name, size, threads, reset_work, [&] {
+                radix_sort(std::execution::par, work.begin(), work.end());
+            });
+
+            runner.run("radix_sort/par/tbbmalloc/" + type_name, size, threads, reset_work, [&] {
+                ScopedDefaultResource guard{tbb::scalable_memory_resource()}; // scratch buffers from tbbmalloc
+                radix_sort(std::execution::par, work.begin(), work.end());
+            });
+        }
+    }
+
+    void compare_pair_sorts(Bench::Runner& runner, size_t size)
+    {
+        using Record = std::pair<uint32_t, uint32_t>;
+
+        const auto keys = make_random<uint32_t>(size);
+        std::vector<Record> data(size);
+        for (size_t i = 0; i < size; ++i)
+            data[i] = Record{keys[i], static_cast<uint32_t>(i)};
+
+        std::vector<Record> work(size);
+        auto reset_work = [&] { std::copy(data.begin(), data.end(), work.begin()); };
+        auto by_key = [](const Record& r) { return r.first; };
+
+        for (auto threads : runner.thread_counts())
+        {
+            tbb::global_control limit{tbb::global_control::max_allowed_parallelism, threads};
+
+            runner.run("std::stable_sort/par_unseq/pair<u32,u32>", size, threads, reset_work, [&] {
+                std::stable_sort(std::execution::par_unseq, work.begin(), work.end(),
+                                 [](const Record& a, const Record& b) { return a.first < b.first; });
+            });
+
+            runner.run("radix_sort/par/pair<u32,u32>", size, threads, reset_work, [&] {
+                radix_sort(std::execution::par, work.begin(), work.end(), by_key);
+            });
+        }
+    }
+}
+
+BENCHMARK_SUITE("radix_sort vs. std::sort")
+{
+    for (auto size : runner.sizes({1'000'000, 10'000'000, 100'000'000}))
+    {
+        compare_sorts<int32_t>(runner, "int32", size);
+        compare_sorts<uint64_t>(runner, "uint64", size);
+        compare_pair_sorts(runner, size);
+    }
+}
+
+BENCHMARK_SUITE("sorting - input distributions")
+{
+    for (auto size : runner.sizes({1'000'000, 10'000'000}))
+    {
+        for (auto distribution : DataGenerator::all_distributions)
+        {
+            const auto data = DataGenerator::generate<int>(distribution, size);
+            const std::string suffix = std::string("/").append(DataGenerator::to_string(distribution));
+
+            std::vector<int> work(size);
+            auto reset_work = [&] { std::copy(data.begin(), data.end(), work.begin()); };
+            const unsigned threads = runner.thread_counts().back();
+
+            runner.run("std::sort/par_unseq" + suffix, size, threads, reset_work, [&] {
+                std::sort(std::execution::par_unseq, work.begin(), work.end());
+            });
+
+            runner.run("radix_sort/par" + suffix, size, threads, reset_work, [&] {
+                radix_sort(std::execution::par, work.begin(), work.end());
+            });
+        }
+    }
+}
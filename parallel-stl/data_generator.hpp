@@ -0,0 +1,334 @@
+#ifndef DATA_GENERATOR_HPP
+#define DATA_GENERATOR_HPP
+
+#include "radix_sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+// Reproducible test data generated in parallel from a seed.
+// Every item is a pure function of (seed, index) - Philox4x32-10 counter-based RNG -
+// so the output does not depend on the number of threads or on the partitioning.
+// Every generator takes an optional allocator for the result, e.g.
+//   DataGenerator::permutation<int>(size, seed, std::pmr::polymorphic_allocator<int>{tbb::scalable_memory_resource()});
+
+namespace DataGenerator
+{
+    class Philox4x32
+    {
+        static constexpr uint32_t multiplier_0 = 0xD2511F53;
+        static constexpr uint32_t multiplier_1 = 0xCD9E8D57;
+        static constexpr uint32_t weyl_0 = 0x9E3779B9;
+        static constexpr uint32_t weyl_1 = 0xBB67AE85;
+        static constexpr int rounds = 10;
+
+        std::array<uint32_t, 2> key_;
+
+    public:
+        explicit constexpr Philox4x32(uint64_t seed)
+            : key_{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}
+        {
+        }
+
+        constexpr std::array<uint32_t, 4> operator()(uint64_t counter, uint32_t stream = 0) const
+        {
+            std::array<uint32_t, 4> block{static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32), stream, 0};
+            auto key = key_;
+
+            for (int round = 0; round < rounds; ++round)
+            {
+                const uint64_t product_0 = uint64_t{multiplier_0} * block[0];
+                const uint64_t product_1 = uint64_t{multiplier_1} * block[2];
+
+                block = {static_cast<uint32_t>(product_1 >> 32) ^ block[1] ^ key[0], static_cast<uint32_t>(product_1),
+                         static_cast<uint32_t>(product_0 >> 32) ^ block[3] ^ key[1], static_cast<uint32_t>(product_0)};
+
+                key[0] += weyl_0;
+                key[1] += weyl_1;
+            }
+
+            return block;
+        }
+
+        // 64 random bits for item [index] - one Philox block serves two consecutive items
+        constexpr uint64_t bits(uint64_t index, uint32_t stream = 0) const
+        {
+            const auto block = (*this)(index / 2, stream);
+            const size_t half = (index % 2) * 2;
+            return (uint64_t{block[half]} << 32) | block[half + 1];
+        }
+    };
+
+    namespace Details
+    {
+        inline constexpr size_t grain_size = 16 * 1024;
+
+        // high 64 bits of a 64x64-bit product
+        inline uint64_t multiply_high(uint64_t a, uint64_t b)
+        {
+#ifdef __SIZEOF_INT128__
+            return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+            const uint64_t a_lo = static_cast<uint32_t>(a), a_hi = a >> 32;
+            const uint64_t b_lo = static_cast<uint32_t>(b), b_hi = b >> 32;
+            const uint64_t cross = (a_lo * b_lo >> 32) + static_cast<uint32_t>(a_hi * b_lo) + a_lo * b_hi;
+            return a_hi * b_hi + (a_hi * b_lo >> 32) + (cross >> 32);
+#endif
+        }
+
+        // data[i] = f(i) in parallel
+        template <typename T, typename Allocator, typename Function>
+        std::vector<T, Allocator> generate_indexed(size_t size, const Allocator& alloc, Function f)
+        {
+            std::vector<T, Allocator> data(size, alloc);
+
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, size, grain_size), [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i)
+                    data[i] = f(i);
+            });
+
+            return data;
+        }
+
+        // data[i] = f(rng.bits(i)) in parallel - computes each Philox block once for a pair of items
+        template <typename T, typename Allocator, typename Function>
+        std::vector<T, Allocator> generate_random(size_t size, const Philox4x32& rng, const Allocator& alloc, Function f)
+        {
+            std::vector<T, Allocator> data(size, alloc);
+
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, size, grain_size), [&](const tbb::blocked_range<size_t>& range) {
+                size_t i = range.begin();
+
+                if (i % 2 == 1 && i != range.end())
+                {
+                    data[i] = f(rng.bits(i));
+                    ++i;
+                }
+
+                for (; i + 1 < range.end(); i += 2)
+                {
+                    const auto block = rng(i / 2);
+                    data[i] = f((uint64_t{block[0]} << 32) | block[1]);
+                    data[i + 1] = f((uint64_t{block[2]} << 32) | block[3]);
+                }
+
+                if (i != range.end())
+                    data[i] = f(rng.bits(i));
+            });
+
+            return data;
+        }
+
+        // maps 64 random bits onto [min, max] (multiply-shift - bias is negligible for test data)
+        template <typename T>
+        T scale(uint64_t bits, T min, T max)
+        {
+            if constexpr (std::is_integral_v<T>)
+            {
+                using U = std::make_unsigned_t<T>;
+                const uint64_t range = static_cast<uint64_t>(static_cast<U>(max) - static_cast<U>(min)) + 1; // 0 - full 64-bit range
+                const uint64_t offset = range == 0 ? bits : multiply_high(bits, range);
+                return static_cast<T>(static_cast<U>(min) + static_cast<U>(offset));
+            }
+            else
+            {
+                const double unit = (bits >> 11) * 0x1.0p-53; // [0, 1)
+                return static_cast<T>(min + unit * (max - min));
+            }
+        }
+
+        inline uint64_t mix(uint64_t x)
+        {
+            x ^= x >> 30;
+            x *= 0xBF58476D1CE4E5B9ULL;
+            x ^= x >> 27;
+            x *= 0x94D049BB133111EBULL;
+            return x ^ (x >> 31);
+        }
+
+        // bijection on [0, size) - balanced Feistel network over 2^bits >= size with cycle walking
+        class RandomPermutation
+        {
+            static constexpr int rounds = 4;
+
+            uint64_t size_;
+            unsigned half_bits_ = 1;
+            std::array<uint64_t, rounds> round_keys_;
+
+        public:
+            RandomPermutation(uint64_t size, uint64_t seed)
+                : size_{size}
+            {
+                while (half_bits_ < 32 && (uint64_t{1} << (2 * half_bits_)) < size)
+                    ++half_bits_;
+
+                const Philox4x32 rng{seed};
+                for (int r = 0; r < rounds; ++r)
+                    round_keys_[r] = rng.bits(r, 0x5EED);
+            }
+
+            uint64_t operator()(uint64_t index) const
+            {
+                do
+                {
+                    index = encrypt(index);
+                } while (index >= size_);
+
+                return index;
+            }
+
+        private:
+            uint64_t encrypt(uint64_t value) const
+            {
+                const uint64_t mask = (uint64_t{1} << half_bits_) - 1;
+
+                uint64_t left = value >> half_bits_;
+                uint64_t right = value & mask;
+
+                for (const auto key : round_keys_)
+                {
+                    const uint64_t next = left ^ (mix(right ^ key) & mask);
+                    left = right;
+                    right = next;
+                }
+
+                return (left << half_bits_) | right;
+            }
+        };
+    }
+
+    // uniformly distributed values from [min, max]
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator> uniform(size_t size, T min, T max, uint64_t seed, const Allocator& alloc = Allocator{})
+    {
+        return Details::generate_random<T>(size, Philox4x32{seed}, alloc, [=](uint64_t bits) { return Details::scale(bits, min, max); });
+    }
+
+    // at most unique_count distinct values: 0, 1, ..., unique_count - 1
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator> few_unique(size_t size, size_t unique_count, uint64_t seed, const Allocator& alloc = Allocator{})
+    {
+        return uniform<T>(size, T{0}, static_cast<T>(std::max<size_t>(unique_count, 1) - 1), seed, alloc);
+    }
+
+    // values 1..value_count with P(k) ~ 1 / k^exponent
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator> zipf(size_t size, size_t value_count, double exponent, uint64_t seed, const Allocator& alloc = Allocator{})
+    {
+        if (value_count == 0)
+            throw std::invalid_argument("zipf requires at least one value");
+
+        std::vector<double> cdf(value_count);
+        double total = 0.0;
+        for (size_t k = 0; k < value_count; ++k)
+            cdf[k] = total += 1.0 / std::pow(static_cast<double>(k + 1), exponent);
+
+        return Details::generate_random<T>(size, Philox4x32{seed}, alloc, [&](uint64_t bits) {
+            const double u = Details::scale(bits, 0.0, total);
+            const auto pos = std::upper_bound(cdf.begin(), cdf.end(), u);
+            return static_cast<T>(std::min<size_t>(pos - cdf.begin(), value_count - 1) + 1);
+        });
+    }
+
+    // random permutation of 0, 1, ..., size - 1
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator> permutation(size_t size, uint64_t seed, const Allocator& alloc = Allocator{})
+    {
+        const Details::RandomPermutation permute{size, seed};
+        return Details::generate_indexed<T>(size, alloc, [&](size_t i) { return static_cast<T>(permute(i)); });
+    }
+
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator> sorted(size_t size, T min, T max, uint64_t seed, const Allocator& alloc = Allocator{})
+    {
+        auto data = uniform<T>(size, min, max, seed, alloc);
+
+        if constexpr (std::is_integral_v<T>)
+            radix_sort(std::execution::par, data.begin(), data.end());
+        else
+            std::sort(std::execution::par_unseq, data.begin(), data.end());
+
+        return data;
+    }
+
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator> reverse_sorted(size_t size, T min, T max, uint64_t seed, const Allocator& alloc = Allocator{})
+    {
+        auto data = sorted<T>(size, min, max, seed, alloc);
+        std::reverse(std::execution::par_unseq, data.begin(), data.end());
+        return data;
+    }
+
+    enum class Distribution
+    {
+        uniform,
+        zipf,
+        sorted,
+        reverse_sorted,
+        few_unique,
+        permutation
+    };
+
+    inline constexpr std::array all_distributions = {Distribution::uniform, Distribution::zipf, Distribution::sorted,
+                                                     Distribution::reverse_sorted, Distribution::few_unique, Distribution::permutation};
+
+    inline std::string_view to_string(Distribution distribution)
+    {
+        switch (distribution)
+        {
+        case Distribution::uniform:
+            return "uniform";
+        case Distribution::zipf:
+            return "zipf";
+        case Distribution::sorted:
+            return "sorted";
+        case Distribution::reverse_sorted:
+            return "reverse_sorted";
+        case Distribution::few_unique:
+            return "few_unique";
+        case Distribution::permutation:
+            return "permutation";
+        }
+        return "unknown";
+    }
+
+    // input with default parameters - shared by sort/reduce benchmarks
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator> generate(Distribution distribution, size_t size, uint64_t seed = 42, const Allocator& alloc = Allocator{})
+    {
+        constexpr T min = std::is_signed_v<T> ? static_cast<T>(-1'000'000) : T{0};
+        constexpr T max = static_cast<T>(1'000'000);
+
+        switch (distribution)
+        {
+        case Distribution::uniform:
+            return uniform<T>(size, min, max, seed, alloc);
+        case Distribution::zipf:
+            return zipf<T>(size, 100'000, 1.1, seed, alloc);
+        case Distribution::sorted:
+            return sorted<T>(size, min, max, seed, alloc);
+        case Distribution::reverse_sorted:
+            return reverse_sorted<T>(size, min, max, seed, alloc);
+        case Distribution::few_unique:
+            return few_unique<T>(size, 16, seed, alloc);
+        case Distribution::permutation:
+            return permutation<T>(size, seed, alloc);
+        }
+
+        throw std::invalid_argument("unknown distribution");
+    }
+}
+
+#endif
@@ -0,0 +1,285 @@
+#ifndef EXECUTION_CONTEXT_HPP
+#define EXECUTION_CONTEXT_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_observer.h>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+// Runs parallel algorithms (std::execution::par, TBB) inside a dedicated task arena:
+//   - concurrency limit - API or PARALLEL_STL_MAX_THREADS environment variable
+//   - threads pinned to a CPU set with sched_setaffinity - API or PARALLEL_STL_CPUS (e.g. "0-3,8")
+//   - per-worker statistics - time spent in the arena vs. wall-clock time
+//
+//   ExecutionContext ctx = ExecutionContext::from_environment();
+//   ctx.execute([&] { std::sort(std::execution::par_unseq, data.begin(), data.end()); });
+
+struct WorkerStats
+{
+    int slot;                              // arena slot (tbb::this_task_arena::current_thread_index())
+    int cpu;                               // CPU the slot is pinned to, -1 - not pinned
+    size_t entries;                        // how many times threads joined the arena in this slot
+    std::chrono::nanoseconds active_time;  // time spent in the arena
+    double utilization;                    // active_time / wall-clock time since reset_stats()
+};
+
+class ExecutionContext
+{
+public:
+    static constexpr const char* max_threads_variable = "PARALLEL_STL_MAX_THREADS";
+    static constexpr const char* cpus_variable = "PARALLEL_STL_CPUS";
+
+    // max_concurrency <= 0 - number of CPUs in cpus (or all cores if cpus is empty)
+    explicit ExecutionContext(int max_concurrency = 0, std::vector<int> cpus = {})
+        : cpus_{std::move(cpus)}
+        , arena_{resolve_concurrency(max_concurrency, cpus_)}
+    {
+        arena_.initialize();
+        slots_ = std::make_unique<SlotStats[]>(arena_.max_concurrency());
+        observer_.emplace(*this);
+        reset_stats();
+    }
+
+    static ExecutionContext from_environment()
+    {
+        std::vector<int> cpus;
+        if (const char* text = std::getenv(cpus_variable))
+            cpus = parse_cpu_list(text);
+
+        int max_concurrency = 0;
+        if (const char* text = std::getenv(max_threads_variable))
+            max_concurrency = std::atoi(text);
+
+        return ExecutionContext{max_concurrency, std::move(cpus)};
+    }
+
+    ExecutionContext(const ExecutionContext&) = delete;
+    ExecutionContext& operator=(const ExecutionContext&) = delete;
+
+    ~ExecutionContext()
+    {
+        observer_.reset();
+    }
+
+    template <typename Function>
+    decltype(auto) execute(Function&& f)
+    {
+        return arena_.execute(std::forward<Function>(f));
+    }
+
+    int max_concurrency() const
+    {
+        return arena_.max_concurrency();
+    }
+
+    const std::vector<int>& cpus() const
+    {
+        return cpus_;
+    }
+
+    static bool affinity_supported()
+    {
+#ifdef __linux__
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void reset_stats()
+    {
+        for (int slot = 0; slot < max_concurrency(); ++slot)
+        {
+            slots_[slot].entries = 0;
+            slots_[slot].active_ns = 0;
+        }
+        stats_start_ = Clock::now();
+    }
+
+    std::vector<WorkerStats> worker_stats() const
+    {
+        const auto wall_time = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - stats_start_);
+
+        std::vector<WorkerStats> stats;
+        for (int slot = 0; slot < max_concurrency(); ++slot)
+        {
+            const std::chrono::nanoseconds active{slots_[slot].active_ns.load()};
+            stats.push_back(WorkerStats{slot, cpu_for_slot(slot), slots_[slot].entries.load(), active,
+                                        wall_time.count() > 0 ? static_cast<double>(active.count()) / wall_time.count() : 0.0});
+        }
+
+        return stats;
+    }
+
+    // average utilization of all slots - 1.0 means every slot was busy all the time
+    double utilization() const
+    {
+        const auto stats = worker_stats();
+
+        double total = 0.0;
+        for (const auto& worker : stats)
+            total += worker.utilization;
+
+        return stats.empty() ? 0.0 : total / stats.size();
+    }
+
+    // "0-3,8,10-11" -> {0, 1, 2, 3, 8, 10, 11}
+    static std::vector<int> parse_cpu_list(std::string_view text)
+    {
+        std::vector<int> cpus;
+
+        auto parse_int = [](std::string_view token) {
+            int value{};
+            const auto [end, error_code] = std::from_chars(token.data(), token.data() + token.size(), value);
+            if (error_code != std::errc{} || end != token.data() + token.size() || value < 0)
+                throw std::invalid_argument("invalid CPU list: " + std::string(token));
+            return value;
+        };
+
+        while (!text.empty())
+        {
+            const auto comma = text.find(',');
+            const auto token = text.substr(0, comma);
+
+            if (const auto dash = token.find('-'); dash != std::string_view::npos)
+            {
+                const int first = parse_int(token.substr(0, dash));
+                const int last = parse_int(token.substr(dash + 1));
+                for (int cpu = first; cpu <= last; ++cpu)
+                    cpus.push_back(cpu);
+            }
+            else if (!token.empty())
+            {
+                cpus.push_back(parse_int(token));
+            }
+
+            text = (comma == std::string_view::npos) ? std::string_view{} : text.substr(comma + 1);
+        }
+
+        return cpus;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct alignas(64) SlotStats // one cache line per slot - no false sharing between workers
+    {
+        std::atomic<size_t> entries{0};
+        std::atomic<int64_t> active_ns{0};
+    };
+
+    class Observer : public tbb::task_scheduler_observer
+    {
+        struct ThreadState
+        {
+            Clock::time_point entry_time;
+            int slot = -1;
+#ifdef __linux__
+            cpu_set_t previous_affinity;
+            bool affinity_changed = false;
+#endif
+        };
+
+        ExecutionContext& context_;
+        tbb::enumerable_thread_specific<ThreadState> thread_states_; // per context - a thread may be inside nested arenas
+
+        ThreadState& thread_state()
+        {
+            return thread_states_.local();
+        }
+
+    public:
+        explicit Observer(ExecutionContext& context)
+            : tbb::task_scheduler_observer{context.arena_}
+            , context_{context}
+        {
+            observe(true);
+        }
+
+        ~Observer() override
+        {
+            observe(false);
+        }
+
+        void on_scheduler_entry(bool) override
+        {
+            auto& state = thread_state();
+            state.slot = tbb::this_task_arena::current_thread_index();
+            state.entry_time = Clock::now();
+
+            if (state.slot < 0 || state.slot >= context_.max_concurrency())
+                return;
+
+            context_.slots_[state.slot].entries.fetch_add(1, std::memory_order_relaxed);
+
+#ifdef __linux__
+            if (const int cpu = context_.cpu_for_slot(state.slot); cpu >= 0)
+            {
+                cpu_set_t cpu_set;
+                CPU_ZERO(&cpu_set);
+                CPU_SET(cpu, &cpu_set);
+
+                state.affinity_changed = sched_getaffinity(0, sizeof(state.previous_affinity), &state.previous_affinity) == 0
+                                      && sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+            }
+#endif
+        }
+
+        void on_scheduler_exit(bool) override
+        {
+            auto& state = thread_state();
+
+            if (state.slot < 0 || state.slot >= context_.max_concurrency())
+                return;
+
+            const auto active = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - state.entry_time);
+            context_.slots_[state.slot].active_ns.fetch_add(active.count(), std::memory_order_relaxed);
+
+#ifdef __linux__
+            if (state.affinity_changed) // the calling thread gets its own affinity back
+                sched_setaffinity(0, sizeof(state.previous_affinity), &state.previous_affinity);
+            state.affinity_changed = false;
+#endif
+            state.slot = -1;
+        }
+    };
+
+    static int resolve_concurrency(int max_concurrency, const std::vector<int>& cpus)
+    {
+        if (max_concurrency > 0)
+            return max_concurrency;
+        if (!cpus.empty())
+            return static_cast<int>(cpus.size());
+        return static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+    int cpu_for_slot(int slot) const
+    {
+        return cpus_.empty() ? -1 : cpus_[slot % cpus_.size()];
+    }
+
+    std::vector<int> cpus_;
+    tbb::task_arena arena_;
+    std::unique_ptr<SlotStats[]> slots_;
+    Clock::time_point stats_start_;
+    std::optional<Observer> observer_; // destroyed before the arena
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef LIST_SORT_HPP
+#define LIST_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <vector>
+
+#include <tbb/parallel_for.h>
+
+// Parallel merge sort for node-based lists:
+//   1. the list is cut by node count into runs (one pass over the nodes)
+//   2. runs are sorted with list::sort on TBB tasks
+//   3. runs are merged pairwise with list::merge - merges on each level run in parallel
+// Nodes are only relinked (splice/merge) - no element is copied or moved, the sort is stable.
+
+namespace ListSortDetails
+{
+    inline constexpr size_t run_size = 16 * 1024;
+
+    // moves the first count nodes of lst to run
+    template <typename T, typename Allocator>
+    void cut_front(std::list<T, Allocator>& lst, size_t count, std::list<T, Allocator>& run)
+    {
+        run.splice(run.end(), lst, lst.begin(), std::next(lst.begin(), count));
+    }
+
+    template <typename T, typename Allocator>
+    void cut_front(std::forward_list<T, Allocator>& lst, size_t count, std::forward_list<T, Allocator>& run)
+    {
+        run.splice_after(run.before_begin(), lst, lst.before_begin(), std::next(lst.begin(), count));
+    }
+
+    template <typename TList, typename Compare>
+    void sort(TList& lst, size_t size, Compare& comp)
+    {
+        if (size <= run_size)
+        {
+            lst.sort(comp);
+            return;
+        }
+
+        const size_t run_count = (size + run_size - 1) / run_size;
+
+        std::vector<TList> runs;
+        runs.reserve(run_count);
+        for (size_t i = 0; i < run_count; ++i)
+            cut_front(lst, std::min(run_size, size - i * run_size), runs.emplace_back(lst.get_allocator()));
+
+        tbb::parallel_for(size_t{0}, run_count, [&](size_t i) { runs[i].sort(comp); });
+
+        // merge order keeps stability: run[i] always precedes run[i + width]
+        for (size_t width = 1; width < run_count; width *= 2)
+        {
+            const size_t pair_count = (run_count + 2 * width - 1) / (2 * width);
+
+            tbb::parallel_for(size_t{0}, pair_count, [&](size_t pair) {
+                const size_t left = pair * 2 * width;
+                if (left + width < run_count)
+                    runs[left].merge(runs[left + width], comp);
+            });
+        }
+
+        lst.swap(runs.front());
+    }
+}
+
+template <typename T, typename Allocator, typename Compare = std::less<>>
+void parallel_sort(std::list<T, Allocator>& lst, Compare comp = {})
+{
+    ListSortDetails::sort(lst, lst.size(), comp);
+}
+
+template <typename T, typename Allocator, typename Compare = std::less<>>
+void parallel_sort(std::forward_list<T, Allocator>& lst, Compare comp = {})
+{
+    ListSortDetails::sort(lst, static_cast<size_t>(std::distance(lst.begin(), lst.end())), comp);
+}
+
+#endif
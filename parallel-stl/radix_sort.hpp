@@ -0,0 +1,162 @@
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+// LSD radix sort for integral keys (8-bit digits, stable)
+//   radix_sort(first, last)                          - sorts integers sequentially
+//   radix_sort(std::execution::par, first, last)     - per-block histograms & scatter on TBB
+//   radix_sort(policy, first, last, key)             - sorts records (e.g. key + payload pairs) by key(record)
+// The value type must be default constructible - a temporary buffer of the same size is allocated
+// from std::pmr::get_default_resource() (ScopedDefaultResource redirects it, e.g. to tbbmalloc).
+
+namespace RadixSortDetails
+{
+    inline constexpr size_t digit_bits = 8;
+    inline constexpr size_t radix = size_t{1} << digit_bits;
+    inline constexpr size_t min_block_size = 64 * 1024;
+
+    using Histogram = std::array<size_t, radix>;
+
+    // maps signed keys onto unsigned ones preserving the order
+    template <typename Key>
+    auto to_unsigned_key(Key key)
+    {
+        using UnsignedKey = std::make_unsigned_t<Key>;
+
+        auto bits = static_cast<UnsignedKey>(key);
+        if constexpr (std::is_signed_v<Key>)
+            bits ^= UnsignedKey{1} << (sizeof(Key) * 8 - 1);
+
+        return bits;
+    }
+
+    template <typename Function>
+    void for_each_block(size_t block_count, bool parallel, Function f)
+    {
+        if (parallel && block_count > 1)
+        {
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, block_count, 1), [&](const tbb::blocked_range<size_t>& blocks) {
+                for (size_t b = blocks.begin(); b != blocks.end(); ++b)
+                    f(b);
+            });
+        }
+        else
+        {
+            for (size_t b = 0; b < block_count; ++b)
+                f(b);
+        }
+    }
+
+    // one counting pass: src -> dst; returns false if all keys share the digit (pass skipped)
+    template <typename SrcIt, typename DstIt, typename DigitFunction>
+    bool scatter_pass(SrcIt src, DstIt dst, size_t size, size_t block_count, bool parallel,
+                      std::pmr::vector<Histogram>& histograms, DigitFunction digit_of)
+    {
+        const size_t block_size = (size + block_count - 1) / block_count;
+
+        for_each_block(block_count, parallel, [&](size_t b) {
+            auto& histogram = histograms[b];
+            histogram.fill(0);
+
+            const size_t end = std::min(size, (b + 1) * block_size);
+            for (size_t i = b * block_size; i < end; ++i)
+                ++histogram[digit_of(src[i])];
+        });
+
+        // exclusive prefix sum over (digit, block) - keeps the sort stable
+        size_t offset = 0;
+        for (size_t digit = 0; digit < radix; ++digit)
+        {
+            const size_t digit_start = offset;
+            for (auto& histogram : histograms)
+                offset += std::exchange(histogram[digit], offset);
+
+            if (offset - digit_start == size)
+                return false;
+        }
+
+        for_each_block(block_count, parallel, [&](size_t b) {
+            auto& positions = histograms[b];
+
+            const size_t end = std::min(size, (b + 1) * block_size);
+            for (size_t i = b * block_size; i < end; ++i)
+                dst[positions[digit_of(src[i])]++] = std::move(src[i]);
+        });
+
+        return true;
+    }
+
+    template <typename RandomIt, typename KeyFunction>
+    void radix_sort(RandomIt first, RandomIt last, KeyFunction key_of, bool parallel)
+    {
+        using T = typename std::iterator_traits<RandomIt>::value_type;
+        using Key = std::decay_t<std::invoke_result_t<KeyFunction&, const T&>>;
+
+        static_assert(std::is_integral_v<Key> && !std::is_same_v<Key, bool>, "radix_sort requires integral keys");
+
+        const size_t size = std::distance(first, last);
+        if (size < 2)
+            return;
+
+        const size_t block_count = parallel
+            ? std::clamp<size_t>(size / min_block_size, 1, 4 * tbb::this_task_arena::max_concurrency())
+            : 1;
+
+        std::pmr::vector<T> buffer(size);
+        std::pmr::vector<Histogram> histograms(block_count);
+        bool sorted_in_buffer = false;
+
+        for (size_t pass = 0; pass < sizeof(Key); ++pass)
+        {
+            const auto shift = pass * digit_bits;
+            auto digit_of = [&key_of, shift](const T& item) {
+                return static_cast<size_t>((to_unsigned_key(std::invoke(key_of, item)) >> shift) & (radix - 1));
+            };
+
+            const bool moved = sorted_in_buffer
+                ? scatter_pass(buffer.begin(), first, size, block_count, parallel, histograms, digit_of)
+                : scatter_pass(first, buffer.begin(), size, block_count, parallel, histograms, digit_of);
+
+            if (moved)
+                sorted_in_buffer = !sorted_in_buffer;
+        }
+
+        if (sorted_in_buffer)
+        {
+            if (parallel)
+                std::move(std::execution::par_unseq, buffer.begin(), buffer.end(), first);
+            else
+                std::move(buffer.begin(), buffer.end(), first);
+        }
+    }
+}
+
+template <typename RandomIt, typename KeyFunction = std::identity>
+void radix_sort(RandomIt first, RandomIt last, KeyFunction key_of = {})
+{
+    RadixSortDetails::radix_sort(first, last, std::move(key_of), false);
+}
+
+template <typename ExecutionPolicy, typename RandomIt, typename KeyFunction = std::identity,
+          typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+void radix_sort(ExecutionPolicy&&, RandomIt first, RandomIt last, KeyFunction key_of = {})
+{
+    constexpr bool parallel = !std::is_same_v<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy>;
+
+    RadixSortDetails::radix_sort(first, last, std::move(key_of), parallel);
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef TBB_MEMORY_RESOURCE_HPP
+#define TBB_MEMORY_RESOURCE_HPP
+
+#include <memory_resource>
+
+#include <tbb/scalable_allocator.h>
+
+// tbb::scalable_memory_resource() (<tbb/scalable_allocator.h>) - std::pmr::memory_resource backed by tbbmalloc
+//   std::pmr::vector<int> vec{tbb::scalable_memory_resource()};
+//   ScopedDefaultResource guard{tbb::scalable_memory_resource()}; // pmr containers without explicit resource use tbbmalloc
+
+// replaces std::pmr::get_default_resource() for the lifetime of the guard
+class ScopedDefaultResource
+{
+    std::pmr::memory_resource* previous_;
+
+public:
+    explicit ScopedDefaultResource(std::pmr::memory_resource* resource)
+        : previous_{std::pmr::set_default_resource(resource)}
+    {
+    }
+
+    ScopedDefaultResource(const ScopedDefaultResource&) = delete;
+    ScopedDefaultResource& operator=(const ScopedDefaultResource&) = delete;
+
+    ~ScopedDefaultResource()
+    {
+        std::pmr::set_default_resource(previous_);
+    }
+};
+
+#endif
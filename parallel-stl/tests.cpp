@@ -1,5 +1,10 @@
+#include "data_generator.hpp"
+#include "radix_sort.hpp"
+#include "tbb_memory_resource.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <memory>
+#include <memory_resource>
 #include <vector>
 #include <string>
 #include <iostream>
@@ -11,13 +16,40 @@
 
 TEST_CASE("parallel-stl")
 {
-    std::vector<int> raw_data(1'000'000);
-    std::iota(raw_data.begin(), raw_data.end(), 0);
+    std::random_device rd;
+    std::vector<int> raw_data = DataGenerator::permutation<int>(1'000'000, rd()); // parallel iota + shuffle
+
+    std::sort(std::execution::par_unseq, raw_data.begin(), raw_data.end());
+    REQUIRE(std::is_sorted(raw_data.begin(), raw_data.end()));
+}
 
+TEST_CASE("parallel-stl - radix sort")
+{
     std::random_device rd;
-    std::mt19937 rnd_gen(rd());
-    std::shuffle(raw_data.begin(), raw_data.end(), rnd_gen);
+    std::vector<int> raw_data = DataGenerator::permutation<int>(1'000'000, rd()); // parallel iota + shuffle
+
+    radix_sort(std::execution::par_unseq, raw_data.begin(), raw_data.end());
+    REQUIRE(std::is_sorted(raw_data.begin(), raw_data.end()));
+}
+
+TEST_CASE("parallel-stl - tbbmalloc")
+{
+    std::random_device rd;
+    std::pmr::vector<int> raw_data = DataGenerator::permutation<int>(1'000'000, rd(), std::pmr::polymorphic_allocator<int>{tbb::scalable_memory_resource()});
 
     std::sort(std::execution::par_unseq, raw_data.begin(), raw_data.end());
     REQUIRE(std::is_sorted(raw_data.begin(), raw_data.end()));
-}
\ No newline at end of file
+    REQUIRE(raw_data.get_allocator().resource() == tbb::scalable_memory_resource());
+}
+
+TEST_CASE("parallel-stl - radix sort - tbbmalloc")
+{
+    ScopedDefaultResource guard{tbb::scalable_memory_resource()}; // data and scratch buffers of radix_sort
+
+    std::random_device rd;
+    std::pmr::vector<int> raw_data = DataGenerator::permutation<int>(1'000'000, rd(), std::pmr::polymorphic_allocator<int>{});
+
+    radix_sort(std::execution::par_unseq, raw_data.begin(), raw_data.end());
+    REQUIRE(std::is_sorted(raw_data.begin(), raw_data.end()));
+    REQUIRE(raw_data.get_allocator().resource() == tbb::scalable_memory_resource());
+}
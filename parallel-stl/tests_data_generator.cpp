@@ -0,0 +1,104 @@
+#include "data_generator.hpp"
+
+#include <algorithm>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <set>
+#include <vector>
+
+#include <tbb/global_control.h>
+
+TEST_CASE("Philox4x32 - known answer")
+{
+    // Random123 known-answer test: counter = 0, key = 0
+    constexpr DataGenerator::Philox4x32 rng{0};
+    constexpr auto block = rng(0);
+
+    static_assert(block[0] == 0x6627E8D5 && block[1] == 0xE169C58D && block[2] == 0xBC57AC4C && block[3] == 0x9B00DBD8);
+}
+
+TEST_CASE("data generator - reproducible for a seed regardless of thread count")
+{
+    std::vector<int> single_thread;
+    {
+        tbb::global_control limit{tbb::global_control::max_allowed_parallelism, 1};
+        single_thread = DataGenerator::uniform<int>(100'000, -500, 500, 665);
+    }
+
+    const auto all_threads = DataGenerator::uniform<int>(100'000, -500, 500, 665);
+    const auto other_seed = DataGenerator::uniform<int>(100'000, -500, 500, 666);
+
+    REQUIRE(single_thread == all_threads);
+    REQUIRE(all_threads != other_seed);
+    REQUIRE(*std::min_element(all_threads.begin(), all_threads.end()) == -500);
+    REQUIRE(*std::max_element(all_threads.begin(), all_threads.end()) == 500);
+}
+
+TEST_CASE("data generator - distributions")
+{
+    constexpr size_t size = 200'000;
+
+    SECTION("uniform doubles")
+    {
+        const auto data = DataGenerator::uniform<double>(size, 1.0, 2.0, 1);
+
+        REQUIRE(std::all_of(data.begin(), data.end(), [](double x) { return x >= 1.0 && x < 2.0; }));
+        REQUIRE(std::accumulate(data.begin(), data.end(), 0.0) / size == Catch::Approx(1.5).epsilon(0.01));
+    }
+
+    SECTION("full 64-bit range")
+    {
+        const auto data = DataGenerator::uniform<uint64_t>(1000, 0, UINT64_MAX, 1);
+        REQUIRE(std::set(data.begin(), data.end()).size() == data.size());
+    }
+
+    SECTION("permutation")
+    {
+        auto data = DataGenerator::permutation<int>(size + 7, 2);
+
+        REQUIRE_FALSE(std::is_sorted(data.begin(), data.end()));
+        std::sort(data.begin(), data.end());
+
+        std::vector<int> expected(size + 7);
+        std::iota(expected.begin(), expected.end(), 0);
+        REQUIRE(data == expected);
+    }
+
+    SECTION("sorted & reverse sorted")
+    {
+        const auto ascending = DataGenerator::sorted<int64_t>(size, -1'000, 1'000, 3);
+        const auto descending = DataGenerator::reverse_sorted<int64_t>(size, -1'000, 1'000, 3);
+
+        REQUIRE(std::is_sorted(ascending.begin(), ascending.end()));
+        REQUIRE(std::equal(ascending.begin(), ascending.end(), descending.rbegin()));
+    }
+
+    SECTION("few unique")
+    {
+        const auto data = DataGenerator::few_unique<unsigned>(size, 8, 4);
+        REQUIRE(std::set(data.begin(), data.end()) == std::set<unsigned>{0, 1, 2, 3, 4, 5, 6, 7});
+    }
+
+    SECTION("zipf - small values are the most frequent")
+    {
+        const auto data = DataGenerator::zipf<int>(size, 1'000, 1.2, 5);
+
+        std::map<int, size_t> histogram;
+        for (auto value : data)
+            ++histogram[value];
+
+        REQUIRE(histogram.begin()->first == 1);
+        REQUIRE(histogram.rbegin()->first <= 1'000);
+        REQUIRE(histogram[1] > histogram[2]);
+        REQUIRE(histogram[2] > histogram[10]);
+    }
+
+    SECTION("generate by name")
+    {
+        for (auto distribution : DataGenerator::all_distributions)
+            REQUIRE(DataGenerator::generate<int>(distribution, 1'000).size() == 1'000);
+    }
+}
@@ -0,0 +1,92 @@
+#include "data_generator.hpp"
+#include "execution_context.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <execution>
+#include <thread>
+#include <vector>
+
+#include <tbb/parallel_for.h>
+
+TEST_CASE("ExecutionContext - parsing CPU lists")
+{
+    REQUIRE(ExecutionContext::parse_cpu_list("0-3,8,10-11") == std::vector{0, 1, 2, 3, 8, 10, 11});
+    REQUIRE(ExecutionContext::parse_cpu_list("").empty());
+    REQUIRE_THROWS_AS(ExecutionContext::parse_cpu_list("1-x"), std::invalid_argument);
+}
+
+TEST_CASE("ExecutionContext - concurrency limit")
+{
+    ExecutionContext ctx{2};
+
+    REQUIRE(ctx.max_concurrency() == 2);
+    REQUIRE(ctx.execute([] { return tbb::this_task_arena::max_concurrency(); }) == 2);
+
+    auto data = DataGenerator::permutation<int>(1'000'000, 8);
+    ctx.execute([&] { std::sort(std::execution::par_unseq, data.begin(), data.end()); });
+
+    REQUIRE(std::is_sorted(data.begin(), data.end()));
+
+    const auto stats = ctx.worker_stats();
+    REQUIRE(stats.size() == 2);
+    REQUIRE(stats[0].entries > 0);
+    REQUIRE(ctx.utilization() > 0.0);
+    REQUIRE(ctx.utilization() <= 1.0);
+}
+
+TEST_CASE("ExecutionContext - nested contexts keep separate statistics")
+{
+    ExecutionContext outer{1};
+    ExecutionContext inner{1};
+
+    outer.execute([&] {
+        inner.execute([] { std::this_thread::sleep_for(std::chrono::milliseconds(20)); });
+    });
+
+    REQUIRE(inner.worker_stats()[0].active_time >= std::chrono::milliseconds(20));
+    REQUIRE(outer.worker_stats()[0].active_time >= std::chrono::milliseconds(20)); // leaving inner does not end outer
+}
+
+#ifdef __linux__
+TEST_CASE("ExecutionContext - threads are pinned to the CPU set")
+{
+    cpu_set_t before;
+    REQUIRE(sched_getaffinity(0, sizeof(before), &before) == 0);
+
+    int first_cpu = 0;
+    while (!CPU_ISSET(first_cpu, &before))
+        ++first_cpu;
+
+    ExecutionContext ctx{0, {first_cpu}};
+    REQUIRE(ctx.max_concurrency() == 1);
+
+    std::atomic<int> foreign_cpus{0};
+    ctx.execute([&] {
+        tbb::parallel_for(0, 10'000, [&](int) {
+            if (sched_getcpu() != first_cpu)
+                ++foreign_cpus;
+        });
+    });
+
+    REQUIRE(foreign_cpus == 0);
+    REQUIRE(ctx.worker_stats()[0].cpu == first_cpu);
+
+    cpu_set_t after;
+    REQUIRE(sched_getaffinity(0, sizeof(after), &after) == 0);
+    REQUIRE(CPU_EQUAL(&before, &after)); // the calling thread is unpinned after execute()
+}
+
+TEST_CASE("ExecutionContext - configuration from environment")
+{
+    setenv(ExecutionContext::max_threads_variable, "3", 1);
+
+    ExecutionContext ctx = ExecutionContext::from_environment();
+    REQUIRE(ctx.max_concurrency() == 3);
+
+    unsetenv(ExecutionContext::max_threads_variable);
+}
+#endif
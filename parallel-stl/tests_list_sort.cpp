@@ -0,0 +1,99 @@
+#include "data_generator.hpp"
+#include "list_sort.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct Pinned
+    {
+        int value;
+
+        explicit Pinned(int v)
+            : value{v}
+        {
+        }
+
+        Pinned(const Pinned&) = delete;
+        Pinned& operator=(const Pinned&) = delete;
+        Pinned(Pinned&&) = delete;
+        Pinned& operator=(Pinned&&) = delete;
+    };
+}
+
+TEST_CASE("parallel_sort - std::list")
+{
+    const auto data = DataGenerator::uniform<int>(200'003, -1'000, 1'000, 11);
+
+    SECTION("ascending & custom comparer")
+    {
+        std::list<int> lst(data.begin(), data.end());
+        parallel_sort(lst);
+
+        auto expected = data;
+        std::sort(expected.begin(), expected.end());
+        REQUIRE(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+
+        parallel_sort(lst, std::greater<>{});
+        REQUIRE(std::equal(lst.begin(), lst.end(), expected.rbegin(), expected.rend()));
+    }
+
+    SECTION("stable")
+    {
+        std::list<std::pair<int, size_t>> lst;
+        for (size_t i = 0; i < data.size(); ++i)
+            lst.emplace_back(data[i], i);
+
+        parallel_sort(lst, [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        REQUIRE(std::is_sorted(lst.begin(), lst.end()));
+    }
+
+    SECTION("nodes are relinked - no copies or moves")
+    {
+        std::list<Pinned> lst;
+        std::vector<const Pinned*> addresses;
+        for (auto value : data)
+            addresses.push_back(&lst.emplace_back(value));
+
+        parallel_sort(lst, [](const Pinned& a, const Pinned& b) { return a.value < b.value; });
+
+        REQUIRE(std::is_sorted(lst.begin(), lst.end(), [](const Pinned& a, const Pinned& b) { return a.value < b.value; }));
+
+        std::vector<const Pinned*> sorted_addresses;
+        for (const auto& item : lst)
+            sorted_addresses.push_back(&item);
+
+        std::sort(addresses.begin(), addresses.end());
+        std::sort(sorted_addresses.begin(), sorted_addresses.end());
+        REQUIRE(addresses == sorted_addresses);
+    }
+
+    SECTION("empty list")
+    {
+        std::list<int> lst;
+        parallel_sort(lst);
+        REQUIRE(lst.empty());
+    }
+}
+
+TEST_CASE("parallel_sort - std::forward_list")
+{
+    const auto data = DataGenerator::uniform<long>(150'001, 0, 100, 12);
+
+    std::forward_list<std::pair<long, size_t>> lst;
+    auto pos = lst.before_begin();
+    for (size_t i = 0; i < data.size(); ++i)
+        pos = lst.emplace_after(pos, data[i], i);
+
+    parallel_sort(lst, [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    REQUIRE(std::distance(lst.begin(), lst.end()) == static_cast<long>(data.size()));
+    REQUIRE(std::is_sorted(lst.begin(), lst.end())); // stable - equal keys keep increasing indexes
+}
@@ -0,0 +1,106 @@
+#include "radix_sort.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <execution>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+template <typename T>
+std::vector<T> random_values(size_t size, T min = std::numeric_limits<T>::min(), T max = std::numeric_limits<T>::max())
+{
+    std::mt19937_64 rnd_gen(665);
+    std::uniform_int_distribution<T> distribution(min, max);
+
+    std::vector<T> values(size);
+    std::generate(values.begin(), values.end(), [&] { return distribution(rnd_gen); });
+    return values;
+}
+
+TEST_CASE("radix_sort - integer keys")
+{
+    SECTION("empty & single item")
+    {
+        std::vector<int> empty;
+        radix_sort(empty.begin(), empty.end());
+        REQUIRE(empty.empty());
+
+        std::vector<int> single = {42};
+        radix_sort(std::execution::par, single.begin(), single.end());
+        REQUIRE(single == std::vector{42});
+    }
+
+    SECTION("signed 32-bit")
+    {
+        auto data = random_values<int32_t>(1'000'000);
+        data.push_back(std::numeric_limits<int32_t>::min());
+        data.push_back(std::numeric_limits<int32_t>::max());
+
+        auto expected = data;
+        std::sort(expected.begin(), expected.end());
+
+        radix_sort(std::execution::par_unseq, data.begin(), data.end());
+
+        REQUIRE(data == expected);
+    }
+
+    SECTION("unsigned 32-bit - sequential")
+    {
+        auto data = random_values<uint32_t>(100'000);
+
+        auto expected = data;
+        std::sort(expected.begin(), expected.end());
+
+        radix_sort(data.begin(), data.end());
+
+        REQUIRE(data == expected);
+    }
+
+    SECTION("signed & unsigned 64-bit")
+    {
+        auto signed_data = random_values<int64_t>(500'000);
+        auto unsigned_data = random_values<uint64_t>(500'000);
+
+        auto signed_expected = signed_data;
+        std::sort(signed_expected.begin(), signed_expected.end());
+        auto unsigned_expected = unsigned_data;
+        std::sort(unsigned_expected.begin(), unsigned_expected.end());
+
+        radix_sort(std::execution::par, signed_data.begin(), signed_data.end());
+        radix_sort(std::execution::par, unsigned_data.begin(), unsigned_data.end());
+
+        REQUIRE(signed_data == signed_expected);
+        REQUIRE(unsigned_data == unsigned_expected);
+    }
+
+    SECTION("narrow key range - passes with one digit are skipped")
+    {
+        auto data = random_values<int64_t>(300'000, -100, 100);
+
+        auto expected = data;
+        std::sort(expected.begin(), expected.end());
+
+        radix_sort(std::execution::par, data.begin(), data.end());
+
+        REQUIRE(data == expected);
+    }
+}
+
+TEST_CASE("radix_sort - key + payload pairs is stable")
+{
+    const auto keys = random_values<int32_t>(400'000, -1000, 1000);
+
+    std::vector<std::pair<int32_t, size_t>> records;
+    for (size_t i = 0; i < keys.size(); ++i)
+        records.emplace_back(keys[i], i);
+
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    radix_sort(std::execution::par, records.begin(), records.end(), [](const auto& record) { return record.first; });
+
+    REQUIRE(records == expected);
+}
@@ -0,0 +1,152 @@
+#include "data_generator.hpp"
+#include "radix_sort.hpp"
+#include "tbb_memory_resource.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <execution>
+#include <memory_resource>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <tbb/parallel_for.h>
+
+namespace
+{
+    // forwards to upstream and counts what passes through
+    class CountingResource : public std::pmr::memory_resource
+    {
+        std::pmr::memory_resource* upstream_;
+        std::atomic<size_t> allocations_{};
+        std::atomic<size_t> allocated_bytes_{};
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            void* ptr = upstream_->allocate(bytes, alignment);
+            ++allocations_;
+            allocated_bytes_ += bytes;
+            return ptr;
+        }
+
+        void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+        {
+            upstream_->deallocate(ptr, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    public:
+        explicit CountingResource(std::pmr::memory_resource* upstream)
+            : upstream_{upstream}
+        {
+        }
+
+        size_t allocations() const
+        {
+            return allocations_;
+        }
+
+        size_t allocated_bytes() const
+        {
+            return allocated_bytes_;
+        }
+    };
+}
+
+TEST_CASE("tbb::scalable_memory_resource")
+{
+    std::pmr::memory_resource* resource = tbb::scalable_memory_resource();
+
+    SECTION("allocations respect alignment")
+    {
+        for (size_t alignment : {alignof(std::max_align_t), size_t{64}, size_t{4096}})
+        {
+            void* ptr = resource->allocate(100, alignment);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0);
+            resource->deallocate(ptr, 100, alignment);
+        }
+    }
+
+    SECTION("equality")
+    {
+        REQUIRE(resource->is_equal(*tbb::scalable_memory_resource()));
+        REQUIRE_FALSE(resource->is_equal(*std::pmr::new_delete_resource()));
+    }
+
+    SECTION("parallel sort of pmr::vector")
+    {
+        const auto data = DataGenerator::permutation<int>(1'000'000, 7);
+
+        std::pmr::vector<int> vec(data.begin(), data.end(), resource);
+        std::sort(std::execution::par_unseq, vec.begin(), vec.end());
+
+        REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+        REQUIRE(vec.get_allocator().resource() == resource);
+    }
+
+    SECTION("pool resource with tbbmalloc upstream - allocations from many threads")
+    {
+        std::pmr::synchronized_pool_resource pool{resource};
+
+        std::atomic<size_t> total_length{};
+
+        tbb::parallel_for(0, 64, [&](int task) {
+            std::pmr::vector<std::pmr::string> words{&pool};
+            for (int i = 0; i < 1'000; ++i)
+                words.emplace_back(std::to_string(task * i) + " - a string long enough to skip SSO");
+
+            for (const auto& word : words)
+                total_length += word.size();
+        });
+
+        REQUIRE(total_length > 64 * 1'000 * 30);
+    }
+}
+
+TEST_CASE("ScopedDefaultResource")
+{
+    std::pmr::memory_resource* previous = std::pmr::get_default_resource();
+
+    {
+        ScopedDefaultResource guard{tbb::scalable_memory_resource()};
+
+        std::pmr::vector<int> vec = {1, 2, 3};
+        REQUIRE(vec.get_allocator().resource() == tbb::scalable_memory_resource());
+    }
+
+    REQUIRE(std::pmr::get_default_resource() == previous);
+}
+
+TEST_CASE("workloads allocate from tbbmalloc")
+{
+    constexpr size_t size = 1'000'000;
+    CountingResource counting{tbb::scalable_memory_resource()};
+
+    auto data = DataGenerator::permutation<int>(size, 7, std::pmr::polymorphic_allocator<int>{&counting});
+
+    SECTION("generated data")
+    {
+        REQUIRE(counting.allocations() == 1);
+        REQUIRE(counting.allocated_bytes() == size * sizeof(int));
+        REQUIRE(scalable_msize(data.data()) >= size * sizeof(int)); // the block belongs to the tbbmalloc heap
+    }
+
+    SECTION("scratch buffers of radix_sort")
+    {
+        const size_t bytes_before = counting.allocated_bytes();
+
+        {
+            ScopedDefaultResource guard{&counting};
+            radix_sort(std::execution::par, data.begin(), data.end());
+        }
+
+        REQUIRE(std::is_sorted(data.begin(), data.end()));
+        REQUIRE(counting.allocated_bytes() - bytes_before >= size * sizeof(int));
+    }
+}
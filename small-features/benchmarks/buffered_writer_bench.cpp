@@ -0,0 +1,131 @@
+#include <bench.hpp>
+#include <buffered_writer.hpp>
+
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace
+{
+    // POSIX descriptor calls - the underscore-prefixed names on Windows
+#ifdef _WIN32
+    int duplicate_fd(int fd)
+    {
+        return ::_dup(fd);
+    }
+
+    void redirect_fd(int from, int to)
+    {
+        ::_dup2(from, to);
+    }
+
+    void close_fd(int fd)
+    {
+        ::_close(fd);
+    }
+
+    int open_null_device()
+    {
+        return ::_open("NUL", _O_WRONLY);
+    }
+#else
+    int duplicate_fd(int fd)
+    {
+        return ::dup(fd);
+    }
+
+    void redirect_fd(int from, int to)
+    {
+        ::dup2(from, to);
+    }
+
+    void close_fd(int fd)
+    {
+        ::close(fd);
+    }
+
+    int open_null_device()
+    {
+        return ::open("/dev/null", O_WRONLY);
+    }
+#endif
+
+    // stdout redirected to /dev/null (NUL on Windows) for the lifetime of the object
+    class SilencedStdout
+    {
+        int saved_fd_;
+
+    public:
+        SilencedStdout()
+            : saved_fd_{duplicate_fd(BufferedWriterDetails::stdout_fd)}
+        {
+            std::cout.flush();
+            const int null_fd = open_null_device();
+            redirect_fd(null_fd, BufferedWriterDetails::stdout_fd);
+            close_fd(null_fd);
+        }
+
+        SilencedStdout(const SilencedStdout&) = delete;
+        SilencedStdout& operator=(const SilencedStdout&) = delete;
+
+        ~SilencedStdout()
+        {
+            std::cout.flush();
+            std::fflush(stdout);
+            redirect_fd(saved_fd_, BufferedWriterDetails::stdout_fd);
+            close_fd(saved_fd_);
+        }
+    };
+
+    template <typename T>
+    void compare_outputs(Bench::Runner& runner, const std::string& type_name, const std::vector<T>& items)
+    {
+        runner.run("std::cout <</" + type_name, items.size(), 1, [&] {
+            SilencedStdout silenced;
+            for (const auto& item : items)
+                std::cout << item << " ";
+            std::cout << "\n";
+        });
+
+        runner.run("BufferedWriter/" + type_name, items.size(), 1, [&] {
+            SilencedStdout silenced;
+            BufferedWriter out;
+            for (const auto& item : items)
+                out << item << " ";
+            out << "\n";
+        });
+    }
+}
+
+BENCHMARK_SUITE("BufferedWriter vs. std::cout")
+{
+    for (auto size : runner.sizes({1'000'000, 10'000'000}))
+    {
+        std::mt19937_64 rnd_gen(42);
+
+        std::vector<int> ints(size);
+        std::uniform_int_distribution<int> int_distribution(-1'000'000, 1'000'000);
+        for (auto& value : ints)
+            value = int_distribution(rnd_gen);
+
+        std::vector<double> doubles(size);
+        std::uniform_real_distribution<double> double_distribution(-1000.0, 1000.0);
+        for (auto& value : doubles)
+            value = double_distribution(rnd_gen);
+
+        std::vector<std::string> strings(size, "token");
+
+        compare_outputs(runner, "int", ints);
+        compare_outputs(runner, "double", doubles);
+        compare_outputs(runner, "string", strings);
+    }
+}
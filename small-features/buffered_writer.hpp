@@ -0,0 +1,286 @@
+#ifndef BUFFERED_WRITER_HPP
+#define BUFFERED_WRITER_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// Output sink for large amounts of formatted data - no locale, no sentry and no virtual call per item:
+//   - integers & floating point values are formatted with std::to_chars (shortest round-trip form for floats)
+//   - text is collected in one buffer and written with a single write(2) per flush (_write on Windows)
+//   - other types fall back to their operator<<
+//
+//   BufferedWriter out;              // stdout, flushed in the destructor
+//   out << "values: ";
+//   out.write_all(values, ", ") << "\n";
+// Writing to stdout flushes std::cout first, so earlier iostream output is not overtaken.
+
+namespace BufferedWriterDetails
+{
+#ifdef _WIN32
+    constexpr int stdout_fd = 1;
+
+    // number of bytes written or -1 with errno set
+    inline std::ptrdiff_t write_some(int fd, const char* data, size_t size)
+    {
+        return ::_write(fd, data, static_cast<unsigned>(std::min<size_t>(size, INT_MAX)));
+    }
+#else
+    constexpr int stdout_fd = STDOUT_FILENO;
+
+    // number of bytes written or -1 with errno set
+    inline std::ptrdiff_t write_some(int fd, const char* data, size_t size)
+    {
+        return ::write(fd, data, size);
+    }
+#endif
+}
+
+class BufferedWriter
+{
+public:
+    static constexpr size_t default_capacity = 64 * 1024;
+    static constexpr size_t min_capacity = 1024;
+
+    explicit BufferedWriter(int fd = BufferedWriterDetails::stdout_fd, size_t capacity = default_capacity)
+        : fd_{fd}
+        , capacity_{std::max(capacity, min_capacity)}
+        , buffer_{std::make_unique_for_overwrite<char[]>(capacity_)}
+    {
+        sync_with_iostream();
+    }
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    ~BufferedWriter()
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    BufferedWriter& write(std::string_view text)
+    {
+        if (text.size() > capacity_ - size_)
+        {
+            flush();
+
+            if (text.size() >= capacity_) // no point in copying - written directly
+            {
+                write_fully(text.data(), text.size());
+                return *this;
+            }
+        }
+
+        std::copy(text.begin(), text.end(), buffer_.get() + size_);
+        size_ += text.size();
+        return *this;
+    }
+
+    BufferedWriter& write(char c)
+    {
+        if (size_ == capacity_)
+            flush();
+
+        buffer_[size_++] = c;
+        return *this;
+    }
+
+    BufferedWriter& write(const char* text)
+    {
+        return write(std::string_view(text));
+    }
+
+    // bool as 1/0 and character types as characters - the same as std::ostream
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    BufferedWriter& write(T value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+            return write(value ? '1' : '0');
+        else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>)
+            return write(static_cast<char>(value));
+        else
+        {
+            append_chars([value](char* first, char* last) { return std::to_chars(first, last, value); });
+            return *this;
+        }
+    }
+
+    // min_width > 0 - right-aligned with spaces, as std::setw(min_width)
+    template <typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
+    BufferedWriter& write(T value, std::chars_format format, int precision, size_t min_width = 0)
+    {
+        const size_t length = append_chars([=](char* first, char* last) { return std::to_chars(first, last, value, format, precision); });
+
+        if (length < min_width)
+            pad_last(length, min_width - length);
+        return *this;
+    }
+
+    // upper-case hex digits left-padded with '0' to min_width
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    BufferedWriter& write_hex(T value, int min_width = 0)
+    {
+        char digits[2 * sizeof(T) + 1];
+        const auto [end, error_code] = std::to_chars(std::begin(digits), std::end(digits), value, 16);
+        const int length = static_cast<int>(end - digits);
+
+        for (int i = length; i < min_width; ++i)
+            write('0');
+        for (char* digit = digits; digit != end; ++digit)
+            write(static_cast<char>(*digit >= 'a' ? *digit - 'a' + 'A' : *digit));
+
+        return *this;
+    }
+
+    // any other type with operator<<
+    template <typename T, typename = std::enable_if_t<!std::is_arithmetic_v<T> && !std::is_convertible_v<const T&, std::string_view>>,
+              typename = void>
+    BufferedWriter& write(const T& value)
+    {
+        thread_local std::ostringstream formatter;
+        formatter.str({});
+        formatter << value;
+        return write(std::string_view(formatter.view()));
+    }
+
+    template <typename T>
+    BufferedWriter& operator<<(const T& value)
+    {
+        if constexpr (std::is_convertible_v<const T&, std::string_view> && !std::is_arithmetic_v<T>)
+            return write(std::string_view(value));
+        else
+            return write(value);
+    }
+
+    template <std::ranges::input_range Range>
+    BufferedWriter& write_all(const Range& items, std::string_view separator = " ")
+    {
+        bool first = true;
+        for (const auto& item : items)
+        {
+            if (!std::exchange(first, false))
+                write(separator);
+            *this << item;
+        }
+        return *this;
+    }
+
+    void flush()
+    {
+        if (size_ == 0)
+            return;
+
+        write_fully(buffer_.get(), size_);
+        size_ = 0;
+    }
+
+    size_t buffered() const
+    {
+        return size_;
+    }
+
+    size_t capacity() const
+    {
+        return capacity_;
+    }
+
+private:
+    // format(first, last) -> std::to_chars_result; returns the number of characters appended
+    template <typename Format>
+    size_t append_chars(Format format)
+    {
+        for (int attempt = 0; attempt < 2; ++attempt)
+        {
+            char* const first = buffer_.get() + size_;
+            const auto [end, error_code] = format(first, buffer_.get() + capacity_);
+
+            if (error_code == std::errc{})
+            {
+                size_ = end - buffer_.get();
+                return end - first;
+            }
+
+            flush(); // the second attempt has the whole buffer
+        }
+
+        throw std::length_error("BufferedWriter: formatted value does not fit in the buffer");
+    }
+
+    // inserts padding spaces before the last length characters of the buffer
+    void pad_last(size_t length, size_t padding)
+    {
+        if (padding > capacity_ - size_)
+        {
+            const std::string text(buffer_.get() + size_ - length, length);
+            size_ -= length;
+            flush();
+
+            for (size_t i = 0; i < padding; ++i)
+                write(' ');
+            write(std::string_view(text));
+            return;
+        }
+
+        char* const first = buffer_.get() + size_ - length;
+        std::copy_backward(first, first + length, first + length + padding);
+        std::fill_n(first, padding, ' ');
+        size_ += padding;
+    }
+
+    void sync_with_iostream() const
+    {
+        if (fd_ == BufferedWriterDetails::stdout_fd)
+            std::cout.flush();
+    }
+
+    void write_fully(const char* data, size_t size)
+    {
+        sync_with_iostream();
+
+        while (size > 0)
+        {
+            const std::ptrdiff_t written = BufferedWriterDetails::write_some(fd_, data, size);
+
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throw std::system_error(errno, std::generic_category(), "BufferedWriter: write failed");
+            }
+
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+    }
+
+    int fd_;
+    size_t capacity_;
+    std::unique_ptr<char[]> buffer_;
+    size_t size_ = 0;
+};
+
+#endif
@@ -1,10 +1,11 @@
+#include "buffered_writer.hpp"
+
 #include <array>
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <string>
 #include <vector>
 #include <span>
-#include <iomanip>
 #include <numeric>
 
 enum class Coffee : uint8_t
@@ -24,12 +25,12 @@ TEST_CASE("enums - direct init")
 
 void print(float const x, std::span<const std::byte> const bytes)
 {
-    std::cout << std::setprecision(6) << std::setw(8) << x << " = { "
-              << std::hex << std::uppercase << std::setfill('0');
+    BufferedWriter out;
+    out.write(x, std::chars_format::general, 6, 8) << " = { ";
 
     for (auto const b : bytes)
-        std::cout << std::setw(2) << std::to_integer<int>(b) << ' ';
-    std::cout << std::dec << "}\n";
+        out.write_hex(std::to_integer<unsigned>(b), 2) << ' ';
+    out << "}\n";
 }
 
 TEST_CASE("C++ & byte")
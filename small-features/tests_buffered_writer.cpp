@@ -0,0 +1,120 @@
+#include "buffered_writer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    struct Point
+    {
+        int x, y;
+    };
+
+    ostream& operator<<(ostream& out, const Point& p)
+    {
+        return out << "(" << p.x << ", " << p.y << ")";
+    }
+
+    int file_descriptor(FILE* file)
+    {
+#ifdef _WIN32
+        return _fileno(file);
+#else
+        return fileno(file);
+#endif
+    }
+
+    // runs writer_action on a BufferedWriter bound to a temporary file and returns the file content
+    // std::tmpfile - a unique file per call, removed when closed
+    template <typename Action>
+    string written_by(Action writer_action, size_t capacity = BufferedWriter::default_capacity)
+    {
+        const unique_ptr<FILE, int (*)(FILE*)> file{tmpfile(), &fclose};
+        REQUIRE(file != nullptr);
+
+        {
+            BufferedWriter out{file_descriptor(file.get()), capacity};
+            writer_action(out);
+        }
+
+        rewind(file.get());
+        string content;
+        char chunk[4096];
+        while (const size_t count = fread(chunk, 1, sizeof(chunk), file.get()))
+            content.append(chunk, count);
+
+        return content;
+    }
+}
+
+TEST_CASE("BufferedWriter")
+{
+    SECTION("text, characters & numbers")
+    {
+        const auto text = written_by([](BufferedWriter& out) {
+            out << "ints: " << 42 << ' ' << -7 << ' ' << 0u << ' ' << numeric_limits<int64_t>::min() << "\n"
+                << "floats: " << 3.14 << ' ' << 0.1f << ' ' << 1e100 << "\n"
+                << "bool: " << true << false << string(" string") << string_view(" view") << "\n";
+        });
+
+        REQUIRE(text == "ints: 42 -7 0 -9223372036854775808\nfloats: 3.14 0.1 1e+100\nbool: 10 string view\n");
+    }
+
+    SECTION("formatted floats & hex")
+    {
+        const auto text = written_by([](BufferedWriter& out) {
+            out.write(3.14159265, chars_format::fixed, 2).write(' ').write(-1.5f, chars_format::general, 6).write(' ');
+            out.write_hex(255u, 4).write(' ').write_hex(uint8_t{10}, 2).write(' ');
+            out.write(3.141592f, chars_format::general, 6, 8).write('|').write(-12345.678, chars_format::fixed, 3, 4);
+        });
+
+        REQUIRE(text == "3.14 -1.5 00FF 0A  3.14159|-12345.678");
+    }
+
+    SECTION("ranges & streamable types")
+    {
+        const auto text = written_by([](BufferedWriter& out) {
+            out.write_all(vector{1, 2, 3}, ", ") << " | ";
+            out.write_all(vector<Point>{{1, 2}, {3, 4}});
+        });
+
+        REQUIRE(text == "1, 2, 3 | (1, 2) (3, 4)");
+    }
+
+    SECTION("output larger than the buffer")
+    {
+        string expected;
+        const auto text = written_by(
+            [&](BufferedWriter& out) {
+                for (int i = 0; i < 10'000; ++i)
+                {
+                    out << i << ' ';
+                    expected += to_string(i) + ' ';
+                }
+                out << string(5000, 'x');
+                expected += string(5000, 'x');
+            },
+            BufferedWriter::min_capacity);
+
+        REQUIRE(text == expected);
+    }
+
+    SECTION("padding when the buffer is almost full")
+    {
+        const auto text = written_by(
+            [](BufferedWriter& out) {
+                out << string(BufferedWriter::min_capacity - 6, '.');
+                out.write(1.5, chars_format::general, 6, 10);
+            },
+            BufferedWriter::min_capacity);
+
+        REQUIRE(text == string(BufferedWriter::min_capacity - 6, '.') + "       1.5");
+    }
+}
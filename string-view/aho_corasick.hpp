@@ -0,0 +1,279 @@
+#ifndef AHO_CORASICK_HPP
+#define AHO_CORASICK_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <queue>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define AHO_CORASICK_HAS_SSE2 1
+#endif
+
+// Multi-pattern search - built once from a set of patterns, then every text is scanned in one pass:
+//   - Aho-Corasick automaton stored as a DFA (no failure links followed while scanning)
+//     over a compressed alphabet: only bytes used by the patterns get their own column
+//   - in the root state the scan jumps to the next byte that starts any pattern
+//     (SSE2 compare of 16 bytes at once when the patterns start with at most 16 distinct bytes)
+//
+//   const AhoCorasick keywords{"ERROR", "timeout", "refused"};
+//   for (const auto& match : keywords.find_all(line))
+//       std::cout << match.text << " at " << match.text.data() - line.data() << "\n";
+// Matches may overlap and are reported in order of their end position.
+
+class AhoCorasick
+{
+public:
+    struct Match
+    {
+        std::string_view text; // view into the searched text
+        size_t pattern;        // index of the pattern in the constructor's list
+    };
+
+    explicit AhoCorasick(const std::vector<std::string_view>& patterns, bool use_prefilter = true)
+    {
+        build(patterns);
+        if (use_prefilter)
+            build_prefilter(patterns);
+    }
+
+    AhoCorasick(std::initializer_list<std::string_view> patterns)
+        : AhoCorasick(std::vector<std::string_view>(patterns))
+    {
+    }
+
+    size_t pattern_count() const
+    {
+        return pattern_lengths_.size();
+    }
+
+    size_t state_count() const
+    {
+        return output_link_.size();
+    }
+
+    // f(const Match&) for every occurrence of every pattern
+    template <typename Function>
+    void for_each_match(std::string_view text, Function f) const
+    {
+        scan(text, [&](size_t end, uint32_t state) {
+            report(text, end, state, f);
+            return true;
+        });
+    }
+
+    std::vector<Match> find_all(std::string_view text) const
+    {
+        std::vector<Match> matches;
+        for_each_match(text, [&](const Match& match) { matches.push_back(match); });
+        return matches;
+    }
+
+    bool contains_any(std::string_view text) const
+    {
+        bool found = false;
+        scan(text, [&](size_t, uint32_t) {
+            found = true;
+            return false;
+        });
+        return found;
+    }
+
+private:
+    static constexpr uint32_t root = 0;
+
+    // on_match(end_position, state) -> false stops the scan
+    template <typename OnMatch>
+    void scan(std::string_view text, OnMatch on_match) const
+    {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+        const size_t size = text.size();
+
+        uint32_t state = root;
+        for (size_t i = 0; i < size; ++i)
+        {
+            if (state == root && has_prefilter_)
+            {
+                i = next_candidate(bytes, i, size);
+                if (i == size)
+                    break;
+            }
+
+            state = transitions_[state * alphabet_size_ + byte_class_[bytes[i]]];
+
+            if (is_match_state_[state] && !on_match(i + 1, state))
+                return;
+        }
+    }
+
+    template <typename Function>
+    void report(std::string_view text, size_t end, uint32_t state, Function& f) const
+    {
+        for (uint32_t s = state; s != root; s = output_link_[s])
+        {
+            for (uint32_t o = output_begin_[s]; o != output_begin_[s + 1]; ++o)
+            {
+                const size_t pattern = outputs_[o];
+                const size_t length = pattern_lengths_[pattern];
+                f(Match{text.substr(end - length, length), pattern});
+            }
+        }
+    }
+
+    // position of the first byte at or after pos that starts a pattern (size if none)
+    size_t next_candidate(const unsigned char* bytes, size_t pos, size_t size) const
+    {
+#ifdef AHO_CORASICK_HAS_SSE2
+        if (first_byte_count_ <= max_vector_first_bytes)
+        {
+            for (; pos + 16 <= size; pos += 16)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + pos));
+                __m128i matches = _mm_setzero_si128();
+                for (size_t i = 0; i < first_byte_count_; ++i)
+                    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8(static_cast<char>(first_bytes_[i]))));
+
+                if (const int mask = _mm_movemask_epi8(matches); mask != 0)
+                    return pos + __builtin_ctz(static_cast<unsigned>(mask));
+            }
+        }
+#endif
+        while (pos < size && !is_first_byte_[bytes[pos]])
+            ++pos;
+        return pos;
+    }
+
+    void build(const std::vector<std::string_view>& patterns)
+    {
+        // alphabet compression - class 0 for every byte no pattern uses
+        for (auto pattern : patterns)
+        {
+            if (pattern.empty())
+                throw std::invalid_argument("AhoCorasick: empty pattern");
+
+            for (unsigned char c : pattern)
+                if (byte_class_[c] == 0)
+                    byte_class_[c] = static_cast<uint16_t>(alphabet_size_++);
+        }
+
+        // trie - a transition to root (0) means "no edge yet"
+        std::vector<uint32_t> terminal_state(patterns.size());
+        add_state();
+
+        for (size_t p = 0; p < patterns.size(); ++p)
+        {
+            uint32_t state = root;
+            for (unsigned char c : patterns[p])
+            {
+                uint32_t& next = transitions_[state * alphabet_size_ + byte_class_[c]];
+                if (next == root)
+                {
+                    const uint32_t child = add_state(); // may reallocate transitions_
+                    transitions_[state * alphabet_size_ + byte_class_[c]] = child;
+                }
+                state = transitions_[state * alphabet_size_ + byte_class_[c]];
+            }
+            terminal_state[p] = state;
+            pattern_lengths_.push_back(patterns[p].size());
+        }
+
+        // outputs grouped by state
+        const size_t states = state_count();
+        output_begin_.assign(states + 1, 0);
+        for (auto state : terminal_state)
+            ++output_begin_[state + 1];
+        for (size_t s = 0; s < states; ++s)
+            output_begin_[s + 1] += output_begin_[s];
+
+        outputs_.resize(patterns.size());
+        std::vector<uint32_t> fill(output_begin_.begin(), output_begin_.end() - 1);
+        for (size_t p = 0; p < patterns.size(); ++p)
+            outputs_[fill[terminal_state[p]]++] = static_cast<uint32_t>(p);
+
+        // BFS: failure links turned into DFA transitions, output links skip states without outputs
+        std::vector<uint32_t> failure(states, root);
+        std::queue<uint32_t> queue;
+
+        for (size_t c = 0; c < alphabet_size_; ++c)
+            if (const uint32_t child = transitions_[c]; child != root)
+                queue.push(child);
+
+        while (!queue.empty())
+        {
+            const uint32_t state = queue.front();
+            queue.pop();
+
+            const uint32_t fail = failure[state];
+            output_link_[state] = has_outputs(fail) ? fail : output_link_[fail];
+            is_match_state_[state] = has_outputs(state) || output_link_[state] != root;
+
+            for (size_t c = 0; c < alphabet_size_; ++c)
+            {
+                uint32_t& next = transitions_[state * alphabet_size_ + c];
+
+                if (next != root && next != state) // trie child
+                {
+                    failure[next] = transitions_[fail * alphabet_size_ + c];
+                    queue.push(next);
+                }
+                else
+                {
+                    next = transitions_[fail * alphabet_size_ + c];
+                }
+            }
+        }
+    }
+
+    void build_prefilter(const std::vector<std::string_view>& patterns)
+    {
+        for (auto pattern : patterns)
+        {
+            const auto first = static_cast<unsigned char>(pattern.front());
+            if (!is_first_byte_[first])
+            {
+                is_first_byte_[first] = true;
+                if (first_byte_count_ < first_bytes_.size())
+                    first_bytes_[first_byte_count_] = first;
+                ++first_byte_count_;
+            }
+        }
+
+        has_prefilter_ = !patterns.empty();
+    }
+
+    uint32_t add_state()
+    {
+        transitions_.resize(transitions_.size() + alphabet_size_, root);
+        output_link_.push_back(root);
+        is_match_state_.push_back(false);
+        return static_cast<uint32_t>(output_link_.size() - 1);
+    }
+
+    bool has_outputs(uint32_t state) const
+    {
+        return output_begin_[state] != output_begin_[state + 1];
+    }
+
+    static constexpr size_t max_vector_first_bytes = 16;
+
+    size_t alphabet_size_ = 1;
+    std::array<uint16_t, 256> byte_class_{};
+    std::vector<uint32_t> transitions_; // state * alphabet_size_ + byte class -> state
+    std::vector<uint32_t> output_link_; // nearest proper suffix state with outputs (root - none)
+    std::vector<uint8_t> is_match_state_;
+    std::vector<uint32_t> output_begin_; // outputs_[output_begin_[s], output_begin_[s + 1]) - patterns ending in s
+    std::vector<uint32_t> outputs_;
+    std::vector<size_t> pattern_lengths_;
+
+    bool has_prefilter_ = false;
+    std::array<bool, 256> is_first_byte_{};
+    std::array<unsigned char, max_vector_first_bytes> first_bytes_{};
+    size_t first_byte_count_ = 0;
+};
+
+#endif
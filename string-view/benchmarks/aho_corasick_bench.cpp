@@ -0,0 +1,102 @@
+#include <aho_corasick.hpp>
+#include <bench.hpp>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    // log-like text: lower-case words of 1-12 letters, every ~500th word is an upper-case keyword
+    std::string make_text(size_t size)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<size_t> length_distribution(1, 12);
+        std::uniform_int_distribution<int> letter_distribution('a', 'z');
+        std::uniform_int_distribution<int> keyword_distribution(0, 499);
+
+        std::string text;
+        text.reserve(size + 16);
+
+        while (text.size() < size)
+        {
+            if (keyword_distribution(rnd_gen) == 0)
+                text += "ERROR";
+            else
+                for (size_t length = length_distribution(rnd_gen); length > 0; --length)
+                    text += static_cast<char>(letter_distribution(rnd_gen));
+            text += ' ';
+        }
+
+        text.resize(size);
+        return text;
+    }
+
+    std::vector<std::string> make_words(size_t count)
+    {
+        std::mt19937_64 rnd_gen(7);
+        std::uniform_int_distribution<size_t> length_distribution(4, 10);
+        std::uniform_int_distribution<int> letter_distribution('a', 'z');
+
+        std::vector<std::string> words(count);
+        for (auto& word : words)
+            for (size_t length = length_distribution(rnd_gen); length > 0; --length)
+                word += static_cast<char>(letter_distribution(rnd_gen));
+
+        return words;
+    }
+
+    size_t count_naive(std::string_view text, const std::vector<std::string_view>& patterns)
+    {
+        size_t count = 0;
+        for (auto pattern : patterns)
+            for (size_t pos = text.find(pattern); pos != std::string_view::npos; pos = text.find(pattern, pos + 1))
+                ++count;
+        return count;
+    }
+
+    size_t count_matches(const AhoCorasick& automaton, std::string_view text)
+    {
+        size_t count = 0;
+        automaton.for_each_match(text, [&](const AhoCorasick::Match&) { ++count; });
+        return count;
+    }
+}
+
+BENCHMARK_SUITE("AhoCorasick - scan throughput")
+{
+    const std::vector<std::string_view> keywords{"ERROR", "FATAL", "WARNING", "Timeout"};
+    const auto words = make_words(1'000);
+    const std::vector<std::string_view> dictionary(words.begin(), words.end());
+
+    const AhoCorasick keyword_automaton{keywords};
+    const AhoCorasick keyword_automaton_no_prefilter{keywords, false};
+    const AhoCorasick dictionary_automaton{dictionary};
+    const AhoCorasick dictionary_automaton_no_prefilter{dictionary, false};
+
+    for (auto size : runner.sizes({1'000'000, 100'000'000}))
+    {
+        const auto text = make_text(size);
+
+        runner.run("4 keywords - string_view::find per pattern", size, 1, [&] {
+            Bench::do_not_optimize(count_naive(text, keywords));
+        });
+
+        runner.run("4 keywords - AhoCorasick (DFA only)", size, 1, [&] {
+            Bench::do_not_optimize(count_matches(keyword_automaton_no_prefilter, text));
+        });
+
+        runner.run("4 keywords - AhoCorasick (SIMD prefilter)", size, 1, [&] {
+            Bench::do_not_optimize(count_matches(keyword_automaton, text));
+        }).counter("matches", static_cast<double>(count_matches(keyword_automaton, text)));
+
+        runner.run("1000 words - AhoCorasick (DFA only)", size, 1, [&] {
+            Bench::do_not_optimize(count_matches(dictionary_automaton_no_prefilter, text));
+        });
+
+        runner.run("1000 words - AhoCorasick (prefilter)", size, 1, [&] {
+            Bench::do_not_optimize(count_matches(dictionary_automaton, text));
+        }).counter("matches", static_cast<double>(count_matches(dictionary_automaton, text)));
+    }
+}
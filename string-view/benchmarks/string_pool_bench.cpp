@@ -0,0 +1,80 @@
+#include <bench.hpp>
+#include <string_pool.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+
+namespace
+{
+    // tokens drawn from a vocabulary of 10K words with a shared prefix - typical log fields
+    std::vector<std::string> make_tokens(size_t size)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<int> word_distribution(0, 9'999);
+
+        std::vector<std::string> tokens(size);
+        for (auto& token : tokens)
+            token = "service.component.field_" + std::to_string(word_distribution(rnd_gen));
+
+        return tokens;
+    }
+}
+
+BENCHMARK_SUITE("StringPool - interning vs. copying")
+{
+    for (auto size : runner.sizes({100'000, 1'000'000, 10'000'000}))
+    {
+        const auto tokens = make_tokens(size);
+
+        runner.run("copy to vector<string>", size, 1, [&] {
+            std::vector<std::string> copies(tokens.begin(), tokens.end());
+            Bench::do_not_optimize(copies.data());
+        });
+
+        runner.run("unordered_set<string>::insert", size, 1, [&] {
+            std::unordered_set<std::string> unique(tokens.begin(), tokens.end());
+            Bench::do_not_optimize(unique.size());
+        });
+
+        runner.run("StringPool::intern", size, 1, [&] {
+            StringPool pool;
+            for (const auto& token : tokens)
+                Bench::do_not_optimize(pool.intern(token));
+        }).counter("saved_bytes", [&] {
+            StringPool pool;
+            for (const auto& token : tokens)
+                pool.intern(token);
+            return static_cast<double>(pool.statistics().saved_bytes());
+        }());
+
+        for (auto threads : runner.thread_counts())
+        {
+            tbb::global_control limit{tbb::global_control::max_allowed_parallelism, threads};
+
+            runner.run("StringPool::intern/par", size, threads, [&] {
+                StringPool pool;
+                tbb::parallel_for(size_t{0}, tokens.size(), [&](size_t i) { Bench::do_not_optimize(pool.intern(tokens[i])); });
+            });
+        }
+
+        StringPool pool;
+        std::vector<Symbol> symbols;
+        for (const auto& token : tokens)
+            symbols.push_back(pool.intern(token));
+
+        runner.run("count equal - std::string ==", size, 1, [&] {
+            Bench::do_not_optimize(std::count(tokens.begin(), tokens.end(), tokens.front()));
+        });
+
+        runner.run("count equal - Symbol ==", size, 1, [&] {
+            Bench::do_not_optimize(std::count(symbols.begin(), symbols.end(), symbols.front()));
+        });
+    }
+}
@@ -0,0 +1,87 @@
+#include <bench.hpp>
+#include <string_sort.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <execution>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tbb/global_control.h>
+
+namespace
+{
+    // keys with long shared prefixes - e.g. URLs or file paths
+    std::vector<std::string> make_urls(size_t size)
+    {
+        static constexpr std::string_view hosts[] = {"https://example.com/", "https://example.com/api/v2/",
+                                                     "https://static.example.com/assets/images/", "https://example.org/"};
+
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<uint64_t> id_distribution(0, size);
+
+        std::vector<std::string> urls;
+        urls.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+            urls.push_back(std::string(hosts[rnd_gen() % std::size(hosts)]) + "item/" + std::to_string(id_distribution(rnd_gen)));
+
+        return urls;
+    }
+
+    // short random words over a small alphabet
+    std::vector<std::string> make_words(size_t size)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<size_t> length_distribution(1, 12);
+        std::uniform_int_distribution<int> letter_distribution('a', 'z');
+
+        std::vector<std::string> words(size);
+        for (auto& word : words)
+        {
+            word.resize(length_distribution(rnd_gen));
+            std::generate(word.begin(), word.end(), [&] { return static_cast<char>(letter_distribution(rnd_gen)); });
+        }
+
+        return words;
+    }
+
+    void compare_sorts(Bench::Runner& runner, const std::string& data_name, const std::vector<std::string>& strings)
+    {
+        const std::vector<std::string_view> data(strings.begin(), strings.end());
+        const size_t size = data.size();
+        std::vector<std::string_view> work(size);
+        auto reset_work = [&] { std::copy(data.begin(), data.end(), work.begin()); };
+
+        runner.run("std::sort/" + data_name, size, 1, reset_work, [&] {
+            std::sort(work.begin(), work.end());
+        });
+
+        runner.run("string_sort/" + data_name, size, 1, reset_work, [&] {
+            string_sort(work.begin(), work.end());
+        });
+
+        for (auto threads : runner.thread_counts())
+        {
+            tbb::global_control limit{tbb::global_control::max_allowed_parallelism, threads};
+
+            runner.run("std::sort/par/" + data_name, size, threads, reset_work, [&] {
+                std::sort(std::execution::par, work.begin(), work.end());
+            });
+
+            runner.run("string_sort/par/" + data_name, size, threads, reset_work, [&] {
+                string_sort(std::execution::par, work.begin(), work.end());
+            });
+        }
+    }
+}
+
+BENCHMARK_SUITE("string_sort vs. std::sort")
+{
+    for (auto size : runner.sizes({100'000, 1'000'000, 10'000'000}))
+    {
+        compare_sorts(runner, "urls", make_urls(size));
+        compare_sorts(runner, "words", make_words(size));
+    }
+}
@@ -0,0 +1,193 @@
+#ifndef STRING_POOL_HPP
+#define STRING_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Interning pool - every distinct string is stored once in a bump-allocated arena:
+//   - intern(text) -> Symbol (32-bit id) - equal strings get equal symbols, so equality compares ids
+//   - view(symbol) / intern_view(text) -> std::string_view valid (and null-terminated) as long as the pool lives
+//   - intern(), find() and view() may be called concurrently
+//
+//   StringPool pool;
+//   std::string_view line = pool.intern_view(get_line()); // no dangling - the pool owns the characters
+//   Symbol error = pool.intern("ERROR");
+
+struct Symbol
+{
+    uint32_t id;
+
+    auto operator<=>(const Symbol&) const = default;
+};
+
+template <>
+struct std::hash<Symbol>
+{
+    size_t operator()(Symbol symbol) const noexcept
+    {
+        return std::hash<uint32_t>{}(symbol.id);
+    }
+};
+
+class StringPool
+{
+public:
+    struct Statistics
+    {
+        size_t intern_calls;    // intern() & intern_view() calls
+        size_t unique_strings;  // strings stored in the arena
+        size_t requested_bytes; // sum of sizes of all interned texts
+        size_t stored_bytes;    // sum of sizes of unique strings
+        size_t arena_bytes;     // memory reserved by the arena blocks
+
+        // bytes that copying every interned text would take on top of the pool
+        size_t saved_bytes() const
+        {
+            return requested_bytes - stored_bytes;
+        }
+    };
+
+    static constexpr size_t default_block_size = 64 * 1024;
+
+    explicit StringPool(size_t block_size = default_block_size)
+        : block_size_{std::max<size_t>(block_size, 64)}
+    {
+    }
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    Symbol intern(std::string_view text)
+    {
+        intern_calls_.fetch_add(1, std::memory_order_relaxed);
+        requested_bytes_.fetch_add(text.size(), std::memory_order_relaxed);
+
+        {
+            std::shared_lock lock{mutex_};
+            if (auto pos = index_.find(text); pos != index_.end())
+                return pos->second;
+        }
+
+        std::unique_lock lock{mutex_};
+        if (auto pos = index_.find(text); pos != index_.end()) // interned by another thread in the meantime
+            return pos->second;
+
+        if (strings_.size() >= std::numeric_limits<uint32_t>::max())
+            throw std::length_error("StringPool: too many symbols");
+
+        const Symbol symbol{static_cast<uint32_t>(strings_.size())};
+        const std::string_view stored = store(text);
+
+        strings_.push_back(stored);
+        index_.emplace(stored, symbol);
+        stored_bytes_ += text.size();
+
+        return symbol;
+    }
+
+    std::string_view intern_view(std::string_view text)
+    {
+        return view(intern(text));
+    }
+
+    // nullopt if text was never interned
+    std::optional<Symbol> find(std::string_view text) const
+    {
+        std::shared_lock lock{mutex_};
+
+        if (auto pos = index_.find(text); pos != index_.end())
+            return pos->second;
+
+        return std::nullopt;
+    }
+
+    // symbol must come from this pool
+    std::string_view view(Symbol symbol) const
+    {
+        std::shared_lock lock{mutex_};
+        return strings_[symbol.id];
+    }
+
+    size_t size() const
+    {
+        std::shared_lock lock{mutex_};
+        return strings_.size();
+    }
+
+    Statistics statistics() const
+    {
+        std::shared_lock lock{mutex_};
+
+        return Statistics{intern_calls_.load(std::memory_order_relaxed), strings_.size(),
+                          requested_bytes_.load(std::memory_order_relaxed), stored_bytes_, arena_bytes_};
+    }
+
+private:
+    // copies text (+ '\0') to the arena - called with the unique lock held
+    std::string_view store(std::string_view text)
+    {
+        const size_t required = text.size() + 1;
+
+        char* destination;
+
+        if (required > block_size_) // long strings get a block of their own - the current block stays in use
+        {
+            destination = allocate_block(required);
+        }
+        else
+        {
+            if (required > remaining_)
+            {
+                current_ = allocate_block(block_size_);
+                remaining_ = block_size_;
+            }
+
+            destination = current_;
+            current_ += required;
+            remaining_ -= required;
+        }
+
+        if (!text.empty())
+            std::memcpy(destination, text.data(), text.size());
+        destination[text.size()] = '\0';
+
+        return std::string_view(destination, text.size());
+    }
+
+    char* allocate_block(size_t size)
+    {
+        blocks_.push_back(std::make_unique_for_overwrite<char[]>(size));
+        arena_bytes_ += size;
+        return blocks_.back().get();
+    }
+
+    size_t block_size_;
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    char* current_ = nullptr;
+    size_t remaining_ = 0;
+
+    std::unordered_map<std::string_view, Symbol> index_; // keys point into the arena
+    std::vector<std::string_view> strings_;              // by Symbol::id
+
+    mutable std::shared_mutex mutex_;
+    std::atomic<size_t> intern_calls_{0};
+    std::atomic<size_t> requested_bytes_{0};
+    size_t stored_bytes_ = 0;
+    size_t arena_bytes_ = 0;
+};
+
+#endif
@@ -0,0 +1,226 @@
+#ifndef STRING_SORT_HPP
+#define STRING_SORT_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <tbb/task_group.h>
+
+// Multikey quicksort (Bentley & Sedgewick) with cached keys (Rantala):
+// 7 bytes of every string at the current depth + a length marker are cached in one uint64_t,
+// so partitioning compares integers and a shared prefix is read once per 7 bytes instead of once per comparison.
+// Like introsort, a run of bad pivots at one depth ends in std::sort - O(n log n) comparisons of suffixes in the worst case.
+// The resulting order is the same as operator< of std::string_view (bytes compared as unsigned char).
+//
+//   string_sort(words.begin(), words.end());
+//   string_sort(std::execution::par, words.begin(), words.end()); // partitions sorted on TBB tasks
+
+namespace StringSortDetails
+{
+    inline constexpr size_t bytes_per_key = 7;
+    inline constexpr size_t insertion_sort_threshold = 32;
+    inline constexpr size_t parallel_threshold = 64 * 1024;
+
+    // [7 bytes from depth, big endian][min(remaining, 7) or 8 if the string continues after those 7 bytes]
+    inline uint64_t cached_key(std::string_view text, size_t depth)
+    {
+        const size_t remaining = text.size() - depth;
+        const size_t count = std::min(remaining, bytes_per_key);
+
+        uint64_t key = 0;
+        for (size_t i = 0; i < count; ++i)
+            key |= uint64_t{static_cast<unsigned char>(text[depth + i])} << (56 - 8 * i);
+
+        return key | (remaining > bytes_per_key ? bytes_per_key + 1 : remaining);
+    }
+
+    inline bool string_continues(uint64_t key)
+    {
+        return (key & 0xFF) > bytes_per_key;
+    }
+
+    template <typename RandomIt>
+    struct Sorter
+    {
+        bool parallel;
+
+        static std::string_view view(const typename std::iterator_traits<RandomIt>::value_type& item)
+        {
+            return std::string_view(item);
+        }
+
+        void insertion_sort(RandomIt first, uint64_t* keys, size_t size, size_t depth) const
+        {
+            for (size_t i = 1; i < size; ++i)
+            {
+                for (size_t j = i; j > 0 && view(first[j]).substr(depth) < view(first[j - 1]).substr(depth); --j)
+                {
+                    std::iter_swap(first + j, first + j - 1);
+                    std::swap(keys[j], keys[j - 1]);
+                }
+            }
+        }
+
+        // keys[0, size) are valid for depth if keys_valid
+        void sort(RandomIt first, uint64_t* keys, size_t size, size_t depth, bool keys_valid) const
+        {
+            if (parallel && size >= parallel_threshold)
+            {
+                tbb::task_group tasks;
+                sort(first, keys, size, depth, keys_valid, depth_limit(size), &tasks);
+                tasks.wait();
+            }
+            else
+            {
+                sort(first, keys, size, depth, keys_valid, depth_limit(size), nullptr);
+            }
+        }
+
+        // the largest partition is sorted in the loop, the other two (at most size / 2 each) recursively -
+        // stack depth is O(log n); partitioning at one depth falls back to std::sort after depth_budget steps
+        void sort(RandomIt first, uint64_t* keys, size_t size, size_t depth, bool keys_valid, size_t depth_budget,
+                  tbb::task_group* tasks) const
+        {
+            while (size > 1)
+            {
+                if (size < insertion_sort_threshold)
+                {
+                    insertion_sort(first, keys, size, depth);
+                    return;
+                }
+
+                if (depth_budget == 0)
+                {
+                    std::sort(first, first + size, [depth](const auto& a, const auto& b) {
+                        return view(a).substr(depth) < view(b).substr(depth);
+                    });
+                    return;
+                }
+                --depth_budget;
+
+                if (!keys_valid)
+                {
+                    for (size_t i = 0; i < size; ++i)
+                        keys[i] = cached_key(view(first[i]), depth);
+                    keys_valid = true;
+                }
+
+                const uint64_t pivot = median_of_three(keys[0], keys[size / 2], keys[size - 1]);
+
+                // 3-way partition: [0, lt) < pivot, [lt, gt) == pivot, [gt, size) > pivot
+                size_t lt = 0, i = 0, gt = size;
+                while (i < gt)
+                {
+                    if (keys[i] < pivot)
+                        swap_items(first, keys, lt++, i++);
+                    else if (keys[i] > pivot)
+                        swap_items(first, keys, i, --gt);
+                    else
+                        ++i;
+                }
+
+                const size_t less_size = lt;
+                const size_t equal_size = string_continues(pivot) ? gt - lt : 0; // otherwise the equal strings are sorted
+                const size_t greater_size = size - gt;
+
+                auto sort_less = [=, this] { sort(first, keys, less_size, depth, true, depth_budget, tasks); };
+                auto sort_greater = [=, this] { sort(first + gt, keys + gt, greater_size, depth, true, depth_budget, tasks); };
+                auto sort_equal = [=, this] {
+                    sort(first + lt, keys + lt, equal_size, depth + bytes_per_key, false, depth_limit(equal_size), tasks);
+                };
+
+                if (equal_size >= less_size && equal_size >= greater_size)
+                {
+                    run(tasks, less_size, sort_less);
+                    run(tasks, greater_size, sort_greater);
+
+                    first += lt;
+                    keys += lt;
+                    size = equal_size;
+                    depth += bytes_per_key;
+                    keys_valid = false;
+                    depth_budget = depth_limit(size);
+                }
+                else if (less_size >= greater_size)
+                {
+                    run(tasks, greater_size, sort_greater);
+                    run(tasks, equal_size, sort_equal);
+
+                    size = less_size;
+                }
+                else
+                {
+                    run(tasks, less_size, sort_less);
+                    run(tasks, equal_size, sort_equal);
+
+                    first += gt;
+                    keys += gt;
+                    size = greater_size;
+                }
+            }
+        }
+
+        // large partitions become tasks of the parallel sort
+        template <typename Function>
+        static void run(tbb::task_group* tasks, size_t size, const Function& sort_partition)
+        {
+            if (tasks && size >= parallel_threshold)
+                tasks->run(sort_partition);
+            else
+                sort_partition();
+        }
+
+        // introsort-style limit of partitioning steps at one depth
+        static size_t depth_limit(size_t size)
+        {
+            return 2 * static_cast<size_t>(std::bit_width(size));
+        }
+
+        static void swap_items(RandomIt first, uint64_t* keys, size_t a, size_t b)
+        {
+            std::iter_swap(first + a, first + b);
+            std::swap(keys[a], keys[b]);
+        }
+
+        static uint64_t median_of_three(uint64_t a, uint64_t b, uint64_t c)
+        {
+            return std::max(std::min(a, b), std::min(std::max(a, b), c));
+        }
+    };
+
+    template <typename RandomIt>
+    void string_sort(RandomIt first, RandomIt last, bool parallel)
+    {
+        const size_t size = std::distance(first, last);
+        if (size < 2)
+            return;
+
+        std::vector<uint64_t> keys(size);
+        Sorter<RandomIt>{parallel}.sort(first, keys.data(), size, 0, false);
+    }
+}
+
+template <typename RandomIt>
+void string_sort(RandomIt first, RandomIt last)
+{
+    StringSortDetails::string_sort(first, last, false);
+}
+
+template <typename ExecutionPolicy, typename RandomIt,
+          typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+void string_sort(ExecutionPolicy&&, RandomIt first, RandomIt last)
+{
+    constexpr bool parallel = !std::is_same_v<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy>;
+
+    StringSortDetails::string_sort(first, last, parallel);
+}
+
+#endif
@@ -0,0 +1,136 @@
+#include "aho_corasick.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    // (begin, end, pattern) of every occurrence - the reference for the automaton
+    vector<tuple<size_t, size_t, size_t>> naive_find_all(string_view text, const vector<string_view>& patterns)
+    {
+        vector<tuple<size_t, size_t, size_t>> matches;
+
+        for (size_t p = 0; p < patterns.size(); ++p)
+            for (size_t pos = text.find(patterns[p]); pos != string_view::npos; pos = text.find(patterns[p], pos + 1))
+                matches.emplace_back(pos, pos + patterns[p].size(), p);
+
+        sort(matches.begin(), matches.end());
+        return matches;
+    }
+
+    vector<tuple<size_t, size_t, size_t>> positions(string_view text, const vector<AhoCorasick::Match>& found)
+    {
+        vector<tuple<size_t, size_t, size_t>> matches;
+
+        for (const auto& match : found)
+        {
+            const size_t begin = match.text.data() - text.data();
+            matches.emplace_back(begin, begin + match.text.size(), match.pattern);
+        }
+
+        sort(matches.begin(), matches.end());
+        return matches;
+    }
+}
+
+TEST_CASE("AhoCorasick")
+{
+    SECTION("matches are views into the searched text")
+    {
+        const AhoCorasick keywords{"ERROR", "timeout", "refused"};
+        const string_view line = "ERROR: connection refused after timeout";
+
+        const auto matches = keywords.find_all(line);
+
+        REQUIRE(matches.size() == 3);
+        REQUIRE(matches[0].text == "ERROR");
+        REQUIRE(matches[0].text.data() == line.data());
+        REQUIRE(matches[1].text == "refused");
+        REQUIRE(matches[1].pattern == 2);
+        REQUIRE(matches[2].text.data() == line.data() + line.find("timeout"));
+    }
+
+    SECTION("overlapping and nested patterns")
+    {
+        const vector<string_view> patterns{"he", "she", "his", "hers"};
+        const AhoCorasick automaton{patterns};
+        const string_view text = "ushers";
+
+        REQUIRE(positions(text, automaton.find_all(text)) == naive_find_all(text, patterns));
+        REQUIRE(automaton.find_all(text).size() == 3);
+    }
+
+    SECTION("duplicated patterns are reported separately")
+    {
+        const AhoCorasick automaton{"abc", "abc", "bc"};
+
+        const auto matches = automaton.find_all("xabc");
+
+        REQUIRE(matches.size() == 3);
+        REQUIRE(all_of(matches.begin(), matches.end(), [](const auto& m) { return m.text.back() == 'c'; }));
+    }
+
+    SECTION("contains_any")
+    {
+        const AhoCorasick automaton{"needle", "pin"};
+
+        REQUIRE(automaton.contains_any(string(10'000, 'h') + "needle"));
+        REQUIRE_FALSE(automaton.contains_any(string(10'000, 'h') + "needl"));
+        REQUIRE_FALSE(automaton.contains_any(""));
+    }
+
+    SECTION("empty pattern is rejected")
+    {
+        REQUIRE_THROWS_AS((AhoCorasick{"a", ""}), invalid_argument);
+    }
+
+    SECTION("the same matches as the naive search - with and without the prefilter")
+    {
+        mt19937_64 rnd_gen(665);
+        uniform_int_distribution<int> letter('a', 'e');
+
+        auto random_text = [&](size_t size) {
+            string text(size, ' ');
+            for (auto& c : text)
+                c = static_cast<char>(letter(rnd_gen));
+            return text;
+        };
+
+        for (size_t pattern_count : {1, 5, 40})
+        {
+            vector<string> storage;
+            for (size_t i = 0; i < pattern_count; ++i)
+                storage.push_back(random_text(1 + i % 4));
+            const vector<string_view> patterns(storage.begin(), storage.end());
+
+            const string text = random_text(5'000) + "\xff\x80 binary \0 bytes"s;
+
+            for (bool prefilter : {true, false})
+            {
+                const AhoCorasick automaton{patterns, prefilter};
+                REQUIRE(positions(text, automaton.find_all(text)) == naive_find_all(text, patterns));
+            }
+        }
+    }
+
+    SECTION("more than 16 distinct first bytes - scalar prefilter")
+    {
+        vector<string> storage;
+        for (char c = 'a'; c <= 'z'; ++c)
+            storage.push_back(string(1, c) + "!");
+        const vector<string_view> patterns(storage.begin(), storage.end());
+
+        const string text = string(100, '.') + "a! b! z!!" + string(100, '.');
+        const AhoCorasick automaton{patterns};
+
+        REQUIRE(positions(text, automaton.find_all(text)) == naive_find_all(text, patterns));
+    }
+}
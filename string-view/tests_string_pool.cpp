@@ -0,0 +1,93 @@
+#include "string_pool.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tbb/parallel_for.h>
+
+using namespace std;
+
+namespace
+{
+    std::string get_line()
+    {
+        return "HELLOWORLD!!!";
+    }
+}
+
+TEST_CASE("StringPool")
+{
+    StringPool pool{256};
+
+    SECTION("equal strings - equal symbols")
+    {
+        const Symbol error = pool.intern("ERROR");
+        const Symbol warning = pool.intern("WARNING");
+
+        REQUIRE(pool.intern("ERROR"s) == error);
+        REQUIRE(error != warning);
+        REQUIRE(pool.view(error) == "ERROR");
+        REQUIRE(pool.find("WARNING") == warning);
+        REQUIRE(pool.find("INFO") == nullopt);
+        REQUIRE(pool.size() == 2);
+    }
+
+    SECTION("views outlive the interned temporaries")
+    {
+        const string_view line = pool.intern_view(get_line());
+        const string_view token = line.substr(line.find("WORLD"));
+
+        REQUIRE(token == "WORLD!!!");
+        REQUIRE(line.data()[line.size()] == '\0'); // safe to pass to C APIs
+    }
+
+    SECTION("views are stable while the arena grows")
+    {
+        const string_view first = pool.intern_view("first");
+        const string_view long_text = pool.intern_view(string(1000, 'x')); // bigger than a block
+
+        vector<string_view> views;
+        for (int i = 0; i < 1000; ++i)
+            views.push_back(pool.intern_view("item" + to_string(i)));
+
+        REQUIRE(pool.intern_view("first").data() == first.data());
+        REQUIRE(pool.intern_view(string(1000, 'x')).data() == long_text.data());
+        for (int i = 0; i < 1000; ++i)
+            REQUIRE(views[i] == "item" + to_string(i));
+    }
+
+    SECTION("statistics")
+    {
+        for (int i = 0; i < 10; ++i)
+            pool.intern("repeated");
+        pool.intern("");
+
+        const auto stats = pool.statistics();
+        REQUIRE(stats.intern_calls == 11);
+        REQUIRE(stats.unique_strings == 2);
+        REQUIRE(stats.requested_bytes == 80);
+        REQUIRE(stats.stored_bytes == 8);
+        REQUIRE(stats.saved_bytes() == 72);
+        REQUIRE(stats.arena_bytes == 256);
+    }
+
+    SECTION("concurrent interning")
+    {
+        constexpr int word_count = 1000;
+        vector<Symbol> symbols(20 * word_count);
+
+        tbb::parallel_for(0, static_cast<int>(symbols.size()), [&](int i) {
+            symbols[i] = pool.intern("word" + to_string(i % word_count));
+        });
+
+        REQUIRE(pool.size() == word_count);
+        for (size_t i = 0; i < symbols.size(); ++i)
+        {
+            REQUIRE(symbols[i] == symbols[i % word_count]);
+            REQUIRE(pool.view(symbols[i]) == "word" + to_string(i % word_count));
+        }
+    }
+}
@@ -0,0 +1,128 @@
+#include "string_sort.hpp"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <execution>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    vector<string> random_strings(size_t size, string_view alphabet, size_t max_length, const string& prefix = "")
+    {
+        mt19937_64 rnd_gen(665);
+        uniform_int_distribution<size_t> length_distribution(0, max_length);
+        uniform_int_distribution<size_t> letter_distribution(0, alphabet.size() - 1);
+
+        vector<string> strings(size);
+        for (auto& text : strings)
+        {
+            text = prefix;
+            for (size_t length = length_distribution(rnd_gen); length > 0; --length)
+                text += alphabet[letter_distribution(rnd_gen)];
+        }
+
+        return strings;
+    }
+
+    void require_same_order_as_std_sort(const vector<string>& strings)
+    {
+        vector<string_view> expected(strings.begin(), strings.end());
+        sort(expected.begin(), expected.end());
+
+        vector<string_view> sorted(strings.begin(), strings.end());
+        string_sort(sorted.begin(), sorted.end());
+        REQUIRE(sorted == expected);
+
+        vector<string_view> sorted_par(strings.begin(), strings.end());
+        string_sort(execution::par, sorted_par.begin(), sorted_par.end());
+        REQUIRE(sorted_par == expected);
+    }
+}
+
+TEST_CASE("string_sort")
+{
+    SECTION("empty & single item")
+    {
+        vector<string_view> empty;
+        string_sort(empty.begin(), empty.end());
+        REQUIRE(empty.empty());
+
+        vector<string_view> single = {"one"};
+        string_sort(single.begin(), single.end());
+        REQUIRE(single == vector<string_view>{"one"});
+    }
+
+    SECTION("words")
+    {
+        vector<string_view> words = {"zero", "one", "two", "four", "three", "", "on", "onee", "one"};
+        string_sort(words.begin(), words.end());
+
+        REQUIRE(words == vector<string_view>{"", "four", "on", "one", "one", "onee", "three", "two", "zero"});
+    }
+
+    SECTION("prefixes of 7-byte cached keys")
+    {
+        require_same_order_as_std_sort({"abcdefg", "abcdefgh", "abcdef", "abcdefgh", "abcdefghijklmn", "abcdefghijklmno",
+                                        "abcdefghijklm", "abcdefg\0"s, "abcdef\0"s, "", "\0"s, "abcdefghijklmn"});
+    }
+
+    SECTION("bytes compared as unsigned char")
+    {
+        require_same_order_as_std_sort({"\x80", "\x7f", "a\xff", "a\x01", "\xff\xff", "a", "\x01"});
+    }
+
+    SECTION("random strings")
+    {
+        require_same_order_as_std_sort(random_strings(100'000, "abcdefghijklmnopqrstuvwxyz", 20));
+    }
+
+    SECTION("long shared prefix & few distinct values")
+    {
+        require_same_order_as_std_sort(random_strings(200'000, "ab", 10, "https://example.com/items/"));
+    }
+
+    SECTION("all bytes & duplicates")
+    {
+        string alphabet;
+        for (int c = 0; c < 256; ++c)
+            alphabet += static_cast<char>(c);
+
+        auto strings = random_strings(100'000, alphabet, 4);
+        strings.insert(strings.end(), strings.begin(), strings.begin() + 50'000);
+
+        require_same_order_as_std_sort(strings);
+    }
+
+    SECTION("median-of-three killer")
+    {
+        // every median of (first, middle, last) is the second smallest key - without a depth limit
+        // each partitioning step peels off two strings: O(n^2) time and O(n) recursion depth
+        const size_t size = 1'000'000;
+
+        vector<string> strings(size);
+        for (size_t i = 0; i + 1 < size; ++i)
+        {
+            const size_t value = i % 3 == 0 ? 2 * (i / 3) : i % 3 == 1 ? 2 * (i / 3) + 3 : 4'000'000 + i;
+            strings[i] = to_string(value);
+            strings[i].insert(0, 7 - strings[i].size(), '0');
+        }
+        strings.back() = "0000001";
+
+        require_same_order_as_std_sort(strings);
+    }
+
+    SECTION("strings as items")
+    {
+        auto strings = random_strings(10'000, "xyz", 12);
+        auto expected = strings;
+        sort(expected.begin(), expected.end());
+
+        string_sort(execution::par, strings.begin(), strings.end());
+        REQUIRE(strings == expected);
+    }
+}
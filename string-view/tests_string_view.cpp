@@ -1,3 +1,5 @@
+#include <buffered_writer.hpp>
+
 #include <algorithm>
 #include <array>
 #include <catch2/catch_approx.hpp>
@@ -13,10 +15,11 @@ using namespace std;
 template <typename Container>
 void print_all(const Container& container, std::string_view prefix)
 {
-    cout << prefix << ": [ ";
+    BufferedWriter out;
+    out << prefix << ": [ ";
     for (const auto& item : container)
-        cout << item << " ";
-    cout << "]\n";
+        out << item << " ";
+    out << "]\n";
 }
 
 TEST_CASE("string_view")
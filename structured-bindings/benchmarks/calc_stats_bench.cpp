@@ -0,0 +1,61 @@
+#include <bench.hpp>
+#include <stats.hpp>
+
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <tbb/global_control.h>
+
+namespace
+{
+    template <typename TContainer>
+    auto two_pass_stats(const TContainer& data)
+    {
+        const auto [min_pos, max_pos] = std::minmax_element(std::begin(data), std::end(data));
+        double avg = std::accumulate(std::begin(data), std::end(data), 0.0) / std::size(data);
+
+        return std::tuple(*min_pos, *max_pos, avg);
+    }
+
+    template <typename T>
+    void compare_stats(Bench::Runner& runner, const std::string& type_name, size_t size)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<int> distribution(-1'000'000, 1'000'000);
+
+        std::vector<T> data(size);
+        std::generate(data.begin(), data.end(), [&] { return static_cast<T>(distribution(rnd_gen)); });
+
+        runner.run("minmax_element+accumulate/" + type_name, size, 1, [&] {
+            Bench::do_not_optimize(two_pass_stats(data));
+        });
+
+        runner.run("calc_stats/" + type_name, size, 1, [&] {
+            Bench::do_not_optimize(calc_stats(data));
+        });
+
+        for (auto threads : runner.thread_counts())
+        {
+            tbb::global_control limit{tbb::global_control::max_allowed_parallelism, threads};
+
+            runner.run("calc_stats/par/" + type_name, size, threads, [&] {
+                Bench::do_not_optimize(calc_stats(std::execution::par, data));
+            });
+        }
+    }
+}
+
+BENCHMARK_SUITE("calc_stats")
+{
+    for (auto size : runner.sizes({1'000'000, 10'000'000, 100'000'000}))
+    {
+        compare_stats<int>(runner, "int", size);
+        compare_stats<float>(runner, "float", size);
+        compare_stats<double>(runner, "double", size);
+    }
+}
@@ -0,0 +1,222 @@
+#ifndef RUNNING_STATS_HPP
+#define RUNNING_STATS_HPP
+
+#include "stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Online statistics (count, min, max, mean, variance) that can be fed chunk by chunk.
+// Partial states (e.g. per thread or per file chunk) are combined with merge() - Welford/Chan update.
+// Supports the tuple-like protocol: const auto [min, max, avg] = stats;
+
+template <typename T>
+class RunningStats
+{
+    static constexpr size_t block_size = 4096;
+
+    size_t count_ = 0;
+    T min_ = std::numeric_limits<T>::max();
+    T max_ = std::numeric_limits<T>::lowest();
+    double mean_ = 0.0;
+    double m2_ = 0.0; // sum of squared differences from the mean
+
+public:
+    RunningStats() = default;
+
+    template <typename TContainer>
+    explicit RunningStats(const TContainer& data)
+    {
+        push(data);
+    }
+
+    void push(const T& value)
+    {
+        ++count_;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+
+        const double delta = value - mean_;
+        mean_ += delta / count_;
+        m2_ += delta * (value - mean_);
+    }
+
+    template <typename TContainer, typename = std::enable_if_t<!std::is_convertible_v<const TContainer&, const T&>>>
+    void push(const TContainer& chunk)
+    {
+        if constexpr (std::ranges::contiguous_range<const TContainer>)
+        {
+            const T* data = std::ranges::data(chunk);
+            const size_t size = std::ranges::size(chunk);
+
+            // cache-sized blocks: fused min/max/sum kernel + second pass for m2 while the block is hot
+            for (size_t start = 0; start < size; start += block_size)
+                merge(summarize_block(data + start, std::min(block_size, size - start)));
+        }
+        else
+        {
+            for (const auto& value : chunk)
+                push(value);
+        }
+    }
+
+    void merge(const RunningStats& other)
+    {
+        if (other.count_ == 0)
+            return;
+
+        if (count_ == 0)
+        {
+            *this = other;
+            return;
+        }
+
+        const size_t count = count_ + other.count_;
+        const double delta = other.mean_ - mean_;
+
+        mean_ += delta * other.count_ / count;
+        m2_ += other.m2_ + delta * delta * (static_cast<double>(count_) * other.count_ / count);
+        count_ = count;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    size_t count() const
+    {
+        return count_;
+    }
+
+    bool empty() const
+    {
+        return count_ == 0;
+    }
+
+    T min() const
+    {
+        return min_;
+    }
+
+    T max() const
+    {
+        return max_;
+    }
+
+    double mean() const
+    {
+        return mean_;
+    }
+
+    // population variance
+    double variance() const
+    {
+        return count_ > 0 ? m2_ / count_ : 0.0;
+    }
+
+    double sample_variance() const
+    {
+        return count_ > 1 ? m2_ / (count_ - 1) : 0.0;
+    }
+
+    double stddev() const
+    {
+        return std::sqrt(variance());
+    }
+
+    // the same shape as calc_stats()
+    std::tuple<T, T, double> result() const
+    {
+        return std::tuple(min_, max_, mean_);
+    }
+
+    template <size_t Index>
+    decltype(auto) get() const
+    {
+        static_assert(Index < 3);
+
+        if constexpr (Index == 0)
+            return min_;
+        else if constexpr (Index == 1)
+            return max_;
+        else
+            return mean_;
+    }
+
+private:
+    static RunningStats summarize_block(const T* data, size_t size)
+    {
+        const auto summary = StatsDetails::summarize(data, size);
+
+        RunningStats block;
+        block.count_ = summary.count;
+        block.min_ = summary.min;
+        block.max_ = summary.max;
+        block.mean_ = summary.sum / summary.count;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            const double delta = data[i] - block.mean_;
+            block.m2_ += delta * delta;
+        }
+
+        return block;
+    }
+};
+
+template <typename TContainer>
+RunningStats(const TContainer&) -> RunningStats<std::ranges::range_value_t<const TContainer>>;
+
+template <typename T>
+struct std::tuple_size<RunningStats<T>>
+{
+    static constexpr size_t value = 3;
+};
+
+template <size_t Index, typename T>
+struct std::tuple_element<Index, RunningStats<T>>
+{
+    using type = std::conditional_t<Index < 2, T, double>;
+};
+
+// partitions of a contiguous range are summarized independently and merged by the execution policy
+template <typename ExecutionPolicy, typename TContainer,
+          typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+auto running_stats(ExecutionPolicy&& policy, const TContainer& data)
+{
+    using T = std::ranges::range_value_t<const TContainer>;
+
+    if constexpr (std::ranges::contiguous_range<const TContainer>)
+    {
+        const T* items = std::ranges::data(data);
+        const size_t size = std::ranges::size(data);
+        const size_t chunk_size = std::max(StatsDetails::min_chunk_size, (size + StatsDetails::max_chunks - 1) / StatsDetails::max_chunks);
+        const size_t chunk_count = (size + chunk_size - 1) / chunk_size;
+
+        std::vector<size_t> chunks(chunk_count);
+        std::iota(chunks.begin(), chunks.end(), size_t{0});
+
+        return std::transform_reduce(
+            std::forward<ExecutionPolicy>(policy), chunks.begin(), chunks.end(), RunningStats<T>{},
+            [](RunningStats<T> a, const RunningStats<T>& b) { a.merge(b); return a; },
+            [=](size_t chunk) {
+                const size_t start = chunk * chunk_size;
+                return RunningStats<T>{std::span(items + start, std::min(chunk_size, size - start))};
+            });
+    }
+    else
+    {
+        return RunningStats<T>{data};
+    }
+}
+
+#endif
@@ -0,0 +1,256 @@
+#ifndef STATS_HPP
+#define STATS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define STATS_HAS_AVX2_KERNELS 1
+#endif
+
+// calc_stats(data) -> std::tuple(min, max, avg) computed in a single pass
+//   - contiguous ranges of int, float & double use AVX2 kernels (selected at runtime)
+//   - calc_stats(std::execution::par, data) splits the work into chunks reduced in parallel
+// precondition: data is not empty
+
+namespace StatsDetails
+{
+    template <typename T>
+    struct Summary
+    {
+        T min = std::numeric_limits<T>::max();
+        T max = std::numeric_limits<T>::lowest();
+        double sum = 0.0;
+        size_t count = 0;
+
+        void merge(const Summary& other)
+        {
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+            sum += other.sum;
+            count += other.count;
+        }
+    };
+
+    template <typename InputIt, typename T = typename std::iterator_traits<InputIt>::value_type>
+    Summary<T> summarize_scalar(InputIt first, InputIt last)
+    {
+        Summary<T> summary{*first, *first, 0.0, 0};
+
+        for (; first != last; ++first)
+        {
+            const auto& value = *first;
+
+            if (value < summary.min)
+                summary.min = value;
+            if (summary.max < value)
+                summary.max = value;
+            summary.sum += value;
+            ++summary.count;
+        }
+
+        return summary;
+    }
+
+#ifdef STATS_HAS_AVX2_KERNELS
+    inline bool has_avx2()
+    {
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+    }
+
+    __attribute__((target("avx2"))) inline Summary<int> summarize_avx2(const int* data, size_t size)
+    {
+        __m256i min = _mm256_set1_epi32(std::numeric_limits<int>::max());
+        __m256i max = _mm256_set1_epi32(std::numeric_limits<int>::min());
+        __m256i sum_low = _mm256_setzero_si256();
+        __m256i sum_high = _mm256_setzero_si256();
+
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            min = _mm256_min_epi32(min, values);
+            max = _mm256_max_epi32(max, values);
+            sum_low = _mm256_add_epi64(sum_low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(values)));
+            sum_high = _mm256_add_epi64(sum_high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(values, 1)));
+        }
+
+        alignas(32) int mins[8], maxs[8];
+        alignas(32) int64_t sums[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(mins), min);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(maxs), max);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(sums), _mm256_add_epi64(sum_low, sum_high));
+
+        Summary<int> summary{*std::min_element(mins, mins + 8), *std::max_element(maxs, maxs + 8), 0.0, i};
+        int64_t sum = sums[0] + sums[1] + sums[2] + sums[3];
+
+        for (; i < size; ++i)
+        {
+            summary.min = std::min(summary.min, data[i]);
+            summary.max = std::max(summary.max, data[i]);
+            sum += data[i];
+            ++summary.count;
+        }
+
+        summary.sum = static_cast<double>(sum);
+        return summary;
+    }
+
+    __attribute__((target("avx2"))) inline Summary<float> summarize_avx2(const float* data, size_t size)
+    {
+        __m256 min = _mm256_set1_ps(std::numeric_limits<float>::max());
+        __m256 max = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+        __m256d sum_low = _mm256_setzero_pd();
+        __m256d sum_high = _mm256_setzero_pd();
+
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            const __m256 values = _mm256_loadu_ps(data + i);
+            min = _mm256_min_ps(min, values);
+            max = _mm256_max_ps(max, values);
+            sum_low = _mm256_add_pd(sum_low, _mm256_cvtps_pd(_mm256_castps256_ps128(values)));
+            sum_high = _mm256_add_pd(sum_high, _mm256_cvtps_pd(_mm256_extractf128_ps(values, 1)));
+        }
+
+        alignas(32) float mins[8], maxs[8];
+        alignas(32) double sums[4];
+        _mm256_store_ps(mins, min);
+        _mm256_store_ps(maxs, max);
+        _mm256_store_pd(sums, _mm256_add_pd(sum_low, sum_high));
+
+        Summary<float> summary{*std::min_element(mins, mins + 8), *std::max_element(maxs, maxs + 8),
+                               sums[0] + sums[1] + sums[2] + sums[3], i};
+
+        for (; i < size; ++i)
+        {
+            summary.min = std::min(summary.min, data[i]);
+            summary.max = std::max(summary.max, data[i]);
+            summary.sum += data[i];
+            ++summary.count;
+        }
+
+        return summary;
+    }
+
+    __attribute__((target("avx2"))) inline Summary<double> summarize_avx2(const double* data, size_t size)
+    {
+        __m256d min = _mm256_set1_pd(std::numeric_limits<double>::max());
+        __m256d max = _mm256_set1_pd(std::numeric_limits<double>::lowest());
+        __m256d sum = _mm256_setzero_pd();
+
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4)
+        {
+            const __m256d values = _mm256_loadu_pd(data + i);
+            min = _mm256_min_pd(min, values);
+            max = _mm256_max_pd(max, values);
+            sum = _mm256_add_pd(sum, values);
+        }
+
+        alignas(32) double mins[4], maxs[4], sums[4];
+        _mm256_store_pd(mins, min);
+        _mm256_store_pd(maxs, max);
+        _mm256_store_pd(sums, sum);
+
+        Summary<double> summary{*std::min_element(mins, mins + 4), *std::max_element(maxs, maxs + 4),
+                                sums[0] + sums[1] + sums[2] + sums[3], i};
+
+        for (; i < size; ++i)
+        {
+            summary.min = std::min(summary.min, data[i]);
+            summary.max = std::max(summary.max, data[i]);
+            summary.sum += data[i];
+            ++summary.count;
+        }
+
+        return summary;
+    }
+#endif
+
+    template <typename T>
+    inline constexpr bool has_simd_kernel = std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    // contiguous block [data, data + size), size > 0
+    template <typename T>
+    Summary<T> summarize(const T* data, size_t size)
+    {
+#ifdef STATS_HAS_AVX2_KERNELS
+        if constexpr (has_simd_kernel<T>)
+        {
+            if (has_avx2())
+                return summarize_avx2(data, size);
+        }
+#endif
+        return summarize_scalar(data, data + size);
+    }
+
+    template <typename TContainer>
+    auto summarize(const TContainer& data)
+    {
+        if constexpr (std::ranges::contiguous_range<const TContainer>)
+            return summarize(std::ranges::data(data), std::ranges::size(data));
+        else
+            return summarize_scalar(std::begin(data), std::end(data));
+    }
+
+    template <typename T>
+    auto to_tuple(const Summary<T>& summary)
+    {
+        return std::tuple(summary.min, summary.max, summary.sum / summary.count);
+    }
+
+    inline constexpr size_t min_chunk_size = 32 * 1024;
+    inline constexpr size_t max_chunks = 1024;
+}
+
+template <typename TContainer>
+auto calc_stats(const TContainer& data)
+{
+    return StatsDetails::to_tuple(StatsDetails::summarize(data));
+}
+
+template <typename ExecutionPolicy, typename TContainer,
+          typename = std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>>
+auto calc_stats(ExecutionPolicy&& policy, const TContainer& data)
+{
+    if constexpr (std::ranges::contiguous_range<const TContainer>)
+    {
+        using T = std::ranges::range_value_t<const TContainer>;
+
+        const T* items = std::ranges::data(data);
+        const size_t size = std::ranges::size(data);
+        const size_t chunk_size = std::max(StatsDetails::min_chunk_size, (size + StatsDetails::max_chunks - 1) / StatsDetails::max_chunks);
+        const size_t chunk_count = (size + chunk_size - 1) / chunk_size;
+
+        std::vector<size_t> chunks(chunk_count);
+        std::iota(chunks.begin(), chunks.end(), size_t{0});
+
+        const auto summary = std::transform_reduce(
+            std::forward<ExecutionPolicy>(policy), chunks.begin(), chunks.end(), StatsDetails::Summary<T>{},
+            [](StatsDetails::Summary<T> a, const StatsDetails::Summary<T>& b) { a.merge(b); return a; },
+            [=](size_t chunk) {
+                const size_t start = chunk * chunk_size;
+                return StatsDetails::summarize(items + start, std::min(chunk_size, size - start));
+            });
+
+        return StatsDetails::to_tuple(summary);
+    }
+    else
+    {
+        return calc_stats(data);
+    }
+}
+
+#endif
@@ -0,0 +1,218 @@
+#include "running_stats.hpp"
+#include "stats.hpp"
+
+#include <algorithm>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <execution>
+#include <list>
+#include <numeric>
+#include <random>
+#include <span>
+#include <sstream>
+#include <vector>
+
+template <typename T>
+std::vector<T> random_data(size_t size, T min, T max)
+{
+    std::mt19937_64 rnd_gen(13);
+    std::vector<T> data(size);
+
+    if constexpr (std::is_integral_v<T>)
+    {
+        std::uniform_int_distribution<T> distribution(min, max);
+        std::generate(data.begin(), data.end(), [&] { return distribution(rnd_gen); });
+    }
+    else
+    {
+        std::uniform_real_distribution<T> distribution(min, max);
+        std::generate(data.begin(), data.end(), [&] { return distribution(rnd_gen); });
+    }
+
+    return data;
+}
+
+template <typename TContainer>
+auto two_pass_stats(const TContainer& data)
+{
+    const auto [min_pos, max_pos] = std::minmax_element(std::begin(data), std::end(data));
+    double avg = std::accumulate(std::begin(data), std::end(data), 0.0) / std::size(data);
+
+    return std::tuple(*min_pos, *max_pos, avg);
+}
+
+TEST_CASE("calc_stats - single pass gives the same results as minmax_element + accumulate")
+{
+    SECTION("int - size not multiple of simd width")
+    {
+        const auto data = random_data<int>(100'003, -1'000'000, 1'000'000);
+
+        const auto [min, max, avg] = calc_stats(data);
+        const auto [expected_min, expected_max, expected_avg] = two_pass_stats(data);
+
+        REQUIRE(min == expected_min);
+        REQUIRE(max == expected_max);
+        REQUIRE(avg == Catch::Approx(expected_avg));
+    }
+
+    SECTION("float")
+    {
+        const auto data = random_data<float>(10'007, -100.0f, 100.0f);
+
+        const auto [min, max, avg] = calc_stats(data);
+        const auto [expected_min, expected_max, expected_avg] = two_pass_stats(data);
+
+        REQUIRE(min == expected_min);
+        REQUIRE(max == expected_max);
+        REQUIRE(avg == Catch::Approx(expected_avg).margin(1e-9));
+    }
+
+    SECTION("double")
+    {
+        const auto data = random_data<double>(10'001, -1e6, 1e6);
+
+        const auto [min, max, avg] = calc_stats(data);
+        const auto [expected_min, expected_max, expected_avg] = two_pass_stats(data);
+
+        REQUIRE(min == expected_min);
+        REQUIRE(max == expected_max);
+        REQUIRE(avg == Catch::Approx(expected_avg).margin(1e-9));
+    }
+
+    SECTION("short ranges & non-contiguous containers")
+    {
+        const std::vector<int> one = {42};
+        REQUIRE(calc_stats(one) == std::tuple(42, 42, 42.0));
+
+        const std::list<long> lst = {5, -3, 10, 7};
+        REQUIRE(calc_stats(lst) == std::tuple(-3L, 10L, 4.75));
+    }
+}
+
+TEST_CASE("calc_stats - execution policies")
+{
+    const auto data = random_data<int>(1'000'000, -1'000, 1'000);
+    const auto expected = two_pass_stats(data);
+
+    const auto [min, max, avg] = calc_stats(std::execution::par, data);
+
+    REQUIRE(min == std::get<0>(expected));
+    REQUIRE(max == std::get<1>(expected));
+    REQUIRE(avg == Catch::Approx(std::get<2>(expected)));
+
+    REQUIRE(calc_stats(std::execution::par_unseq, data) == calc_stats(data));
+    REQUIRE(calc_stats(std::execution::seq, std::list{3, 1, 2}) == std::tuple(1, 3, 2.0));
+}
+
+///////////////////////////////////////////////////////////////////////////
+// RunningStats
+
+template <typename TContainer>
+double naive_variance(const TContainer& data)
+{
+    const double mean = std::accumulate(std::begin(data), std::end(data), 0.0) / std::size(data);
+    const double sum_sq = std::accumulate(std::begin(data), std::end(data), 0.0,
+                                          [mean](double acc, auto x) { return acc + (x - mean) * (x - mean); });
+    return sum_sq / std::size(data);
+}
+
+TEST_CASE("RunningStats")
+{
+    const auto data = random_data<double>(100'000, -50.0, 150.0);
+    const auto [expected_min, expected_max, expected_avg] = two_pass_stats(data);
+    const double expected_variance = naive_variance(data);
+
+    SECTION("pushing items one by one")
+    {
+        RunningStats<double> stats;
+        for (const auto& value : data)
+            stats.push(value);
+
+        REQUIRE(stats.count() == data.size());
+        REQUIRE(stats.min() == expected_min);
+        REQUIRE(stats.max() == expected_max);
+        REQUIRE(stats.mean() == Catch::Approx(expected_avg));
+        REQUIRE(stats.variance() == Catch::Approx(expected_variance));
+    }
+
+    SECTION("pushing chunks")
+    {
+        RunningStats<double> stats;
+        for (size_t start = 0; start < data.size(); start += 7'001)
+            stats.push(std::span(data).subspan(start, std::min<size_t>(7'001, data.size() - start)));
+
+        REQUIRE(stats.count() == data.size());
+        REQUIRE(stats.mean() == Catch::Approx(expected_avg));
+        REQUIRE(stats.variance() == Catch::Approx(expected_variance));
+    }
+
+    SECTION("merging partial states")
+    {
+        const auto middle = data.begin() + 33'333;
+        RunningStats left{std::vector(data.begin(), middle)};
+        RunningStats<double> right;
+        right.push(std::list(middle, data.end()));
+
+        RunningStats<double> empty;
+        left.merge(empty);
+        empty.merge(left);
+        empty.merge(right);
+
+        REQUIRE(empty.count() == data.size());
+        REQUIRE(empty.min() == expected_min);
+        REQUIRE(empty.max() == expected_max);
+        REQUIRE(empty.mean() == Catch::Approx(expected_avg));
+        REQUIRE(empty.sample_variance() == Catch::Approx(expected_variance * data.size() / (data.size() - 1)));
+    }
+
+    SECTION("parallel partitions")
+    {
+        const auto stats = running_stats(std::execution::par, data);
+
+        REQUIRE(stats.count() == data.size());
+        REQUIRE(stats.mean() == Catch::Approx(expected_avg));
+        REQUIRE(stats.stddev() == Catch::Approx(std::sqrt(expected_variance)));
+    }
+
+    SECTION("structured bindings")
+    {
+        const auto [min, max, avg] = RunningStats{data};
+
+        REQUIRE(min == expected_min);
+        REQUIRE(max == expected_max);
+        REQUIRE(avg == Catch::Approx(expected_avg));
+
+        int imin, imax;
+        std::tie(imin, imax, std::ignore) = RunningStats{std::vector{4, 42, 665, 1, 123, 13}}.result();
+        REQUIRE(imin == 1);
+        REQUIRE(imax == 665);
+    }
+}
+
+TEST_CASE("RunningStats - streaming input chunk by chunk")
+{
+    std::istringstream input("4 42 665 1 123 13 8 -7 99 0 3");
+
+    RunningStats<int> stats;
+    std::vector<int> chunk;
+    chunk.reserve(4);
+
+    for (int value; input >> value;)
+    {
+        chunk.push_back(value);
+        if (chunk.size() == chunk.capacity())
+        {
+            stats.push(chunk);
+            chunk.clear();
+        }
+    }
+    stats.push(chunk);
+
+    const auto [min, max, avg] = stats;
+
+    REQUIRE(stats.count() == 11);
+    REQUIRE(min == -7);
+    REQUIRE(max == 665);
+    REQUIRE(avg == Catch::Approx(951.0 / 11));
+}
@@ -1,3 +1,5 @@
+#include "stats.hpp"
+
 #include <algorithm>
 #include <array>
 #include <catch2/catch_approx.hpp>
@@ -26,16 +28,6 @@ namespace [[deprecated]] BeforeCpp17
     }
 }
 
-template <typename TContainer>
-auto calc_stats(const TContainer& data)
-{
-    const auto [min_pos, max_pos] = std::minmax_element(std::begin(data), std::end(data));
-
-    double avg = std::accumulate(std::begin(data), std::end(data), 0.0) / std::size(data); // since C++17 - std::size
-
-    return std::tuple(*min_pos, *max_pos, avg);
-}
-
 TEST_CASE("Before C++17")
 {
     std::vector<int> data = {4, 42, 665, 1, 123, 13};
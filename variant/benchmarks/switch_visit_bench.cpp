@@ -0,0 +1,107 @@
+#include <bench.hpp>
+#include <overload.hpp>
+
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+// std::visit vs. Switch::visit (a switch over index()) with the same overload{} visitor
+// libstdc++ (GCC 11+) already compiles a single-variant std::visit into a switch - expect parity there;
+// multi-variant std::visit still goes through a table of function pointers
+
+namespace
+{
+    using Value = std::variant<int, double, std::string>;
+
+    std::vector<Value> make_values(size_t size)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<int> distribution(0, 2);
+
+        std::vector<Value> values;
+        values.reserve(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            switch (distribution(rnd_gen))
+            {
+            case 0:
+                values.emplace_back(static_cast<int>(i));
+                break;
+            case 1:
+                values.emplace_back(static_cast<double>(i));
+                break;
+            default:
+                values.emplace_back(std::string(i % 16, 'x'));
+            }
+        }
+
+        return values;
+    }
+
+    const auto weight = overload{
+        [](int v) { return static_cast<double>(v); },
+        [](double v) { return v * 0.5; },
+        [](const std::string& s) { return static_cast<double>(s.size()); }
+    };
+
+    const auto product = overload{
+        [](const std::string& a, const std::string& b) { return static_cast<double>(a.size() * b.size()); },
+        [](const std::string& a, auto b) { return static_cast<double>(a.size()) * b; },
+        [](auto a, const std::string& b) { return a * static_cast<double>(b.size()); },
+        [](auto a, auto b) { return static_cast<double>(a) * b; }
+    };
+}
+
+BENCHMARK_SUITE("std::visit vs. Switch::visit")
+{
+    for (auto size : runner.sizes({1'000'000, 10'000'000}))
+    {
+        const auto values = make_values(size);
+
+        runner.run("std::visit - overload", size, 1, [&] {
+            double total = 0.0;
+            for (const auto& value : values)
+                total += std::visit(weight, value);
+            Bench::do_not_optimize(total);
+        });
+
+        runner.run("Switch::visit - overload", size, 1, [&] {
+            double total = 0.0;
+            for (const auto& value : values)
+                total += Switch::visit(weight, value);
+            Bench::do_not_optimize(total);
+        });
+
+        runner.run("std::visit - two variants", size, 1, [&] {
+            double total = 0.0;
+            for (size_t i = 1; i < values.size(); ++i)
+                total += std::visit(product, values[i - 1], values[i]);
+            Bench::do_not_optimize(total);
+        });
+
+        runner.run("Switch::visit - two variants", size, 1, [&] {
+            double total = 0.0;
+            for (size_t i = 1; i < values.size(); ++i)
+                total += Switch::visit(product, values[i - 1], values[i]);
+            Bench::do_not_optimize(total);
+        });
+
+        const std::vector<Value> ints(size, Value{42});
+
+        runner.run("std::visit - single alternative", size, 1, [&] {
+            double total = 0.0;
+            for (const auto& value : ints)
+                total += std::visit(weight, value);
+            Bench::do_not_optimize(total);
+        });
+
+        runner.run("Switch::visit - single alternative", size, 1, [&] {
+            double total = 0.0;
+            for (const auto& value : ints)
+                total += Switch::visit(weight, value);
+            Bench::do_not_optimize(total);
+        });
+    }
+}
@@ -0,0 +1,91 @@
+#include <bench.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+// std::visit dispatches on index() - a random mix of alternatives defeats the branch predictor,
+// the same items grouped by alternative do not (run with --perf to see branch_misses/item)
+
+namespace
+{
+    using Value = std::variant<int, double, std::string>;
+
+    struct Weight
+    {
+        double operator()(int v) const
+        {
+            return v;
+        }
+
+        double operator()(double v) const
+        {
+            return v * 0.5;
+        }
+
+        double operator()(const std::string& s) const
+        {
+            return static_cast<double>(s.size());
+        }
+    };
+
+    std::vector<Value> make_values(size_t size)
+    {
+        std::mt19937_64 rnd_gen(42);
+        std::uniform_int_distribution<int> distribution(0, 2);
+
+        std::vector<Value> values;
+        values.reserve(size);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            switch (distribution(rnd_gen))
+            {
+            case 0:
+                values.emplace_back(static_cast<int>(i));
+                break;
+            case 1:
+                values.emplace_back(static_cast<double>(i));
+                break;
+            default:
+                values.emplace_back(std::string(i % 16, 'x'));
+            }
+        }
+
+        return values;
+    }
+
+    double visit_all(const std::vector<Value>& values)
+    {
+        double total = 0.0;
+        for (const auto& value : values)
+            total += std::visit(Weight{}, value);
+        return total;
+    }
+}
+
+BENCHMARK_SUITE("std::visit - branch prediction")
+{
+    for (auto size : runner.sizes({1'000'000, 10'000'000}))
+    {
+        auto values = make_values(size);
+
+        runner.run("std::visit/random", size, 1, [&] {
+            Bench::do_not_optimize(visit_all(values));
+        });
+
+        std::stable_sort(values.begin(), values.end(), [](const Value& a, const Value& b) { return a.index() < b.index(); });
+
+        runner.run("std::visit/grouped by index", size, 1, [&] {
+            Bench::do_not_optimize(visit_all(values));
+        });
+
+        const std::vector<Value> ints(size, Value{42});
+
+        runner.run("std::visit/single alternative", size, 1, [&] {
+            Bench::do_not_optimize(visit_all(ints));
+        });
+    }
+}
@@ -0,0 +1,145 @@
+#ifndef OVERLOAD_HPP
+#define OVERLOAD_HPP
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// overload - a visitor assembled from lambdas:
+//   auto printer = overload{[](int v) { ... }, [](const std::string& s) { ... }};
+//
+// Switch::visit - drop-in replacement for std::visit that dispatches with a switch over index():
+//   size_t size = Switch::visit(overload{...}, var);
+//   Switch::visit(overload{...}, var1, var2); // multi-variant - one nested switch per variant
+// std::visit is commonly an indirect call through a table of function pointers, which the
+// optimizer does not see through - with a switch the visitor's overloads are inlined into the cases.
+// Variants with more than Switch::max_cases alternatives fall back to std::visit.
+
+template <typename... Ts>
+struct overload : Ts...
+{
+    using Ts::operator()...;
+};
+
+// deduction guide
+template <typename... Ts>
+overload(Ts...) -> overload<Ts...>;
+
+namespace Switch
+{
+    constexpr size_t max_cases = 16;
+
+    namespace SwitchDetails
+    {
+        [[noreturn]] inline void unreachable()
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_unreachable();
+#elif defined(_MSC_VER)
+            __assume(false);
+#endif
+        }
+
+        // std::get<Index> without the bad_variant_access path - get_if still compares index() with Index,
+        // inside case Index the result is already known, so an optimizing compiler can fold the check away
+        template <size_t Index, typename Variant>
+        decltype(auto) get_unchecked(Variant&& variant)
+        {
+            using Alternative = decltype(std::get<Index>(std::forward<Variant>(variant)));
+            return static_cast<Alternative>(*std::get_if<Index>(&variant));
+        }
+
+        template <typename Visitor, typename Variant, size_t Index>
+        using AlternativeResult = std::invoke_result_t<Visitor, decltype(std::get<Index>(std::declval<Variant>()))>;
+
+        template <typename Visitor, typename Variant,
+                  typename Indexes = std::make_index_sequence<std::variant_size_v<std::remove_cvref_t<Variant>>>>
+        struct VisitResult;
+
+        // like std::visit - the visitor must return the same type for every alternative
+        template <typename Visitor, typename Variant, size_t... Indexes>
+        struct VisitResult<Visitor, Variant, std::index_sequence<Indexes...>>
+        {
+            using type = AlternativeResult<Visitor, Variant, 0>;
+            static constexpr bool same_for_all = (std::is_same_v<type, AlternativeResult<Visitor, Variant, Indexes>> && ...);
+        };
+
+        template <typename Visitor, typename Variant>
+        using Result = typename VisitResult<Visitor, Variant>::type;
+
+        template <typename Visitor, typename Variant>
+        Result<Visitor, Variant> visit_one(Visitor&& visitor, Variant&& variant)
+        {
+            static_assert(VisitResult<Visitor, Variant>::same_for_all,
+                          "Switch::visit requires the visitor to return the same type for all alternatives");
+
+            constexpr size_t size = std::variant_size_v<std::remove_cvref_t<Variant>>;
+
+            if constexpr (size > max_cases)
+            {
+                return std::visit(std::forward<Visitor>(visitor), std::forward<Variant>(variant));
+            }
+            else
+            {
+#define SWITCH_VISIT_CASE(Index)                                                                                  \
+    case Index:                                                                                                   \
+        if constexpr (Index < size)                                                                               \
+            return std::invoke(std::forward<Visitor>(visitor), get_unchecked<Index>(std::forward<Variant>(variant))); \
+        else                                                                                                      \
+            unreachable();
+
+                switch (variant.index())
+                {
+                    SWITCH_VISIT_CASE(0)
+                    SWITCH_VISIT_CASE(1)
+                    SWITCH_VISIT_CASE(2)
+                    SWITCH_VISIT_CASE(3)
+                    SWITCH_VISIT_CASE(4)
+                    SWITCH_VISIT_CASE(5)
+                    SWITCH_VISIT_CASE(6)
+                    SWITCH_VISIT_CASE(7)
+                    SWITCH_VISIT_CASE(8)
+                    SWITCH_VISIT_CASE(9)
+                    SWITCH_VISIT_CASE(10)
+                    SWITCH_VISIT_CASE(11)
+                    SWITCH_VISIT_CASE(12)
+                    SWITCH_VISIT_CASE(13)
+                    SWITCH_VISIT_CASE(14)
+                    SWITCH_VISIT_CASE(15)
+                default: // std::variant_npos
+                    throw std::bad_variant_access{};
+                }
+
+#undef SWITCH_VISIT_CASE
+            }
+        }
+    }
+
+    // throws std::bad_variant_access if any of the variants is valueless_by_exception()
+    template <typename Visitor, typename Variant, typename... Variants>
+    decltype(auto) visit(Visitor&& visitor, Variant&& variant, Variants&&... variants)
+    {
+        if constexpr (sizeof...(Variants) == 0)
+        {
+            return SwitchDetails::visit_one(std::forward<Visitor>(visitor), std::forward<Variant>(variant));
+        }
+        else
+        {
+            // bind the alternative of the first variant, then switch over the rest
+            return SwitchDetails::visit_one(
+                [&](auto&& alternative) -> decltype(auto) {
+                    return Switch::visit(
+                        [&](auto&&... rest) -> decltype(auto) {
+                            return std::invoke(std::forward<Visitor>(visitor), std::forward<decltype(alternative)>(alternative),
+                                               std::forward<decltype(rest)>(rest)...);
+                        },
+                        std::forward<Variants>(variants)...);
+                },
+                std::forward<Variant>(variant));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,129 @@
+#include "overload.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    struct ThrowsOnCopy
+    {
+        ThrowsOnCopy() = default;
+
+        ThrowsOnCopy(const ThrowsOnCopy&)
+        {
+            throw runtime_error("copy");
+        }
+    };
+
+    struct Describe // a visitor class, like Printer in tests_variants.cpp
+    {
+        string operator()(int v) const
+        {
+            return "int: " + to_string(v);
+        }
+
+        string operator()(const string& s) const
+        {
+            return "string: " + s;
+        }
+
+        string operator()(const vector<int>& v) const
+        {
+            return "vec of size " + to_string(v.size());
+        }
+    };
+}
+
+TEST_CASE("Switch::visit")
+{
+    variant<int, string, vector<int>> var = "text"s;
+
+    auto size_of = overload{
+        [](int v) -> size_t { return v; },
+        [](const string& s) { return s.size(); },
+        [](const vector<int>& v) { return v.size(); }
+    };
+
+    SECTION("same result as std::visit")
+    {
+        REQUIRE(Switch::visit(size_of, var) == visit(size_of, var));
+        REQUIRE(Switch::visit(Describe{}, var) == visit(Describe{}, var));
+
+        var = 42;
+        REQUIRE(Switch::visit(size_of, var) == 42);
+        REQUIRE(Switch::visit(Describe{}, var) == visit(Describe{}, var));
+
+        var = vector{1, 2, 3};
+        REQUIRE(Switch::visit(size_of, var) == 3);
+        REQUIRE(Switch::visit(Describe{}, var) == visit(Describe{}, var));
+    }
+
+    SECTION("alternatives are passed by reference")
+    {
+        Switch::visit(overload{
+            [](int& v) { v = 0; },
+            [](string& s) { s += "!"; },
+            [](vector<int>& v) { v.clear(); }
+        }, var);
+
+        REQUIRE(get<string>(var) == "text!");
+    }
+
+    SECTION("rvalue variants are moved from")
+    {
+        auto ptr = Switch::visit([](auto&& value) { return make_unique<decay_t<decltype(value)>>(std::move(value)); },
+                                 variant<string>{"moved"s});
+
+        REQUIRE(*ptr == "moved");
+    }
+
+    SECTION("multi-variant visitation")
+    {
+        variant<int, double> number = 2.5;
+
+        auto describe = overload{
+            [](int, const string&) { return "int & string"s; },
+            [](double, const string&) { return "double & string"s; },
+            [](auto, const auto&) { return "other"s; }
+        };
+
+        REQUIRE(Switch::visit(describe, number, var) == "double & string");
+
+        number = 1;
+        var = vector<int>{};
+        REQUIRE(Switch::visit(describe, number, var) == "other");
+
+        variant<char, int> third = 'x';
+        REQUIRE(Switch::visit([](auto a, const auto&, auto c) { return sizeof(a) + sizeof(c); }, number, var, third) == sizeof(int) + 1);
+    }
+
+    SECTION("the visitor returns the same type for every alternative")
+    {
+        auto mixed = overload{
+            [](int v) { return v; },
+            [](double d) { return d; }
+        };
+
+        // Switch::visit(mixed, number) does not compile - as with std::visit, double is not truncated to int
+        static_assert(!Switch::SwitchDetails::VisitResult<decltype(mixed)&, variant<int, double>&>::same_for_all);
+        static_assert(Switch::SwitchDetails::VisitResult<decltype(size_of)&, decltype(var)&>::same_for_all);
+    }
+
+    SECTION("valueless variant throws bad_variant_access")
+    {
+        variant<int, ThrowsOnCopy> valueless;
+        const ThrowsOnCopy source;
+        REQUIRE_THROWS_AS(valueless = source, runtime_error);
+        REQUIRE(valueless.valueless_by_exception());
+
+        REQUIRE_THROWS_AS(Switch::visit([](const auto&) {}, valueless), bad_variant_access);
+        REQUIRE_THROWS_AS(Switch::visit([](const auto&, const auto&) {}, var, valueless), bad_variant_access);
+    }
+}
@@ -1,3 +1,5 @@
+#include "overload.hpp"
+
 #include <algorithm>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -81,18 +83,6 @@ struct Lambda_7234762567
     auto operator()(int x) const { return x * x; }
 };
 
-//////////////////////////////////////
-// overload
-template <typename... Ts>
-struct overload : Ts...
-{
-    using Ts::operator()...;
-};
-
-// deduction guide
-template <typename... Ts>
-overload(Ts...) -> overload<Ts...>;
-
 TEST_CASE("visiting variants")
 {
     std::variant<int, std::string, std::vector<int>> var;